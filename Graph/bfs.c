@@ -0,0 +1,379 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bfs.h"
+#include "parallel.h"
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+typedef struct BFSContext
+{
+    const CSRGraph *graph;
+    int *parent;
+
+    // Sparse frontier (top-down)
+    int *queue;
+    long long queueSize;
+    int **localNext;            // per-thread discovered vertices
+    long long *localCount;
+    long long *localCapacity;
+    long long *localScout;      // per-thread sum of degrees discovered
+
+    // Dense frontier (bottom-up)
+    unsigned long long *frontier;
+    unsigned long long *next;
+    long long words;
+    long long *localAwake;
+} BFSContext;
+
+/*
+ * pushLocal - Appends v to this thread's discovery buffer
+ */
+static void pushLocal(BFSContext *context, int thread, int v)
+{
+    if (context->localCount[thread] == context->localCapacity[thread])
+    {
+        long long capacity = context->localCapacity[thread] * 2;
+        int *grown = (int *)realloc(context->localNext[thread], capacity * sizeof(int));
+        if (grown == NULL)
+        {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        context->localNext[thread] = grown;
+        context->localCapacity[thread] = capacity;
+    }
+    context->localNext[thread][context->localCount[thread]++] = v;
+}
+
+/*
+ * topDownWorker - Expands this thread's slice of the frontier queue
+ *
+ * A vertex is claimed by whoever wins the CAS on parent[v], so each
+ * vertex enters the next frontier exactly once.
+ */
+static void topDownWorker(void *arg, int thread, int threads)
+{
+    BFSContext *context = (BFSContext *)arg;
+    const long long *offsets = context->graph->offsets;
+    const int *neighbors = context->graph->neighbors;
+    int *parent = context->parent;
+    long long first, last;
+    threadRange(context->queueSize, thread, threads, &first, &last);
+
+    context->localCount[thread] = 0;
+    long long scout = 0;
+
+    for (long long i = first; i < last; i++)
+    {
+        int u = context->queue[i];
+        for (long long e = offsets[u]; e < offsets[u + 1]; e++)
+        {
+            int v = neighbors[e];
+            int unvisited = -1;
+            if (__atomic_load_n(&parent[v], __ATOMIC_RELAXED) == -1 &&
+                __atomic_compare_exchange_n(&parent[v], &unvisited, u, 0,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                pushLocal(context, thread, v);
+                scout += offsets[v + 1] - offsets[v];
+            }
+        }
+    }
+
+    context->localScout[thread] = scout;
+}
+
+/*
+ * bottomUpWorker - Lets every unvisited vertex in this thread's slice look
+ * for a parent in the frontier bitmap
+ *
+ * Slices are whole 64-bit words, so each thread owns its words of `next`
+ * and its entries of parent[]: no atomics needed.
+ */
+static void bottomUpWorker(void *arg, int thread, int threads)
+{
+    BFSContext *context = (BFSContext *)arg;
+    const long long *offsets = context->graph->offsets;
+    const int *neighbors = context->graph->neighbors;
+    const unsigned long long *frontier = context->frontier;
+    int *parent = context->parent;
+    int n = context->graph->n;
+    long long firstWord, lastWord;
+    threadRange(context->words, thread, threads, &firstWord, &lastWord);
+
+    long long awake = 0;
+    long long scout = 0;
+    for (long long w = firstWord; w < lastWord; w++)
+    {
+        unsigned long long bits = 0;
+        long long vEnd = (w + 1) * 64 < n ? (w + 1) * 64 : n;
+
+        for (long long v = w * 64; v < vEnd; v++)
+        {
+            if (parent[v] != -1)
+                continue;
+
+            for (long long e = offsets[v]; e < offsets[v + 1]; e++)
+            {
+                int u = neighbors[e];
+                if (frontier[u >> 6] & (1ULL << (u & 63)))
+                {
+                    parent[v] = u;
+                    bits |= 1ULL << (v & 63);
+                    awake++;
+                    scout += offsets[v + 1] - offsets[v];
+                    break;
+                }
+            }
+        }
+        context->next[w] = bits;
+    }
+
+    context->localAwake[thread] = awake;
+    context->localScout[thread] = scout;
+}
+
+/*
+ * gatherQueue - Concatenates the per-thread discovery buffers into queue
+ *
+ * Returns: sum of the degrees of the new frontier (the "scout count")
+ */
+static long long gatherQueue(BFSContext *context, int threads)
+{
+    long long size = 0;
+    long long scout = 0;
+
+    for (int t = 0; t < threads; t++)
+    {
+        memcpy(context->queue + size, context->localNext[t], context->localCount[t] * sizeof(int));
+        size += context->localCount[t];
+        scout += context->localScout[t];
+    }
+    context->queueSize = size;
+
+    return scout;
+}
+
+static void queueToBitmap(BFSContext *context)
+{
+    memset(context->frontier, 0, context->words * sizeof(unsigned long long));
+    for (long long i = 0; i < context->queueSize; i++)
+    {
+        int v = context->queue[i];
+        context->frontier[v >> 6] |= 1ULL << (v & 63);
+    }
+}
+
+/*
+ * bitmapToQueue - Lists the vertices of the frontier bitmap in the queue
+ *
+ * Returns: sum of the degrees of the frontier, like gatherQueue
+ */
+static long long bitmapToQueue(BFSContext *context)
+{
+    const long long *offsets = context->graph->offsets;
+    long long size = 0;
+    long long scout = 0;
+    for (long long w = 0; w < context->words; w++)
+    {
+        unsigned long long bits = context->frontier[w];
+        while (bits != 0)
+        {
+            int v = (int)(w * 64 + __builtin_ctzll(bits));
+            context->queue[size++] = v;
+            scout += offsets[v + 1] - offsets[v];
+            bits &= bits - 1;
+        }
+    }
+    context->queueSize = size;
+
+    return scout;
+}
+
+/*
+ * recordLevel - Appends per-level statistics to the result
+ */
+static void recordLevel(BFSResult *result, int *capacity, int bottomUp, long long frontier, double seconds)
+{
+    if (result->levelCount == *capacity)
+    {
+        *capacity *= 2;
+        BFSLevel *grown = (BFSLevel *)realloc(result->levels, *capacity * sizeof(BFSLevel));
+        if (grown == NULL)
+        {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        result->levels = grown;
+    }
+
+    result->levels[result->levelCount].bottomUp = bottomUp;
+    result->levels[result->levelCount].frontier = frontier;
+    result->levels[result->levelCount].seconds = seconds;
+    result->levelCount++;
+    result->visited += frontier;
+}
+
+/*
+ * bfs - Breadth-first search from source
+ * @graph: symmetric CSR graph
+ * @threads: worker threads per step
+ * @mode: BFS_AUTO for direction-optimizing, or force one direction
+ *
+ * Returns: parent array and per-level timing, or NULL on failure
+ *
+ * Time Complexity: O(n + m) top-down; bottom-up levels usually touch far
+ * fewer edges than that on low-diameter graphs
+ */
+BFSResult *bfs(const CSRGraph *graph, int source, int threads, BFSMode mode)
+{
+    if (threads < 1)
+        threads = 1;
+
+    int n = graph->n;
+    BFSResult *result = (BFSResult *)calloc(1, sizeof(BFSResult));
+    int levelCapacity = 16;
+    BFSContext context;
+    memset(&context, 0, sizeof(context));
+
+    context.graph = graph;
+    context.words = (n + 63) / 64;
+    context.parent = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    context.queue = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    context.frontier = (unsigned long long *)calloc(context.words + 1, sizeof(unsigned long long));
+    context.next = (unsigned long long *)calloc(context.words + 1, sizeof(unsigned long long));
+    context.localNext = (int **)calloc(threads, sizeof(int *));
+    context.localCount = (long long *)calloc(threads, sizeof(long long));
+    context.localCapacity = (long long *)calloc(threads, sizeof(long long));
+    context.localScout = (long long *)calloc(threads, sizeof(long long));
+    context.localAwake = (long long *)calloc(threads, sizeof(long long));
+    if (result != NULL)
+        result->levels = (BFSLevel *)malloc(levelCapacity * sizeof(BFSLevel));
+
+    int failed = result == NULL || result->levels == NULL || context.parent == NULL ||
+                 context.queue == NULL || context.frontier == NULL || context.next == NULL ||
+                 context.localNext == NULL || context.localCount == NULL ||
+                 context.localCapacity == NULL || context.localScout == NULL ||
+                 context.localAwake == NULL || source < 0 || source >= n;
+    for (int t = 0; !failed && t < threads; t++)
+    {
+        context.localCapacity[t] = 1024;
+        context.localNext[t] = (int *)malloc(1024 * sizeof(int));
+        failed = context.localNext[t] == NULL;
+    }
+
+    if (failed)
+    {
+        printf("BFS setup failed!\n");
+        if (result != NULL)
+            free(result->levels);
+        free(result);
+        free(context.parent);
+        result = NULL;
+    }
+    else
+    {
+        double start = nowSeconds();
+        for (int v = 0; v < n; v++)
+            context.parent[v] = -1;
+
+        context.parent[source] = source;
+        context.queue[0] = source;
+        context.queueSize = 1;
+        recordLevel(result, &levelCapacity, 0, 1, 0.0);
+
+        long long scout = csrDegree(graph, source);
+        long long edgesToCheck = graph->m;
+
+        while (context.queueSize > 0)
+        {
+            int goBottomUp = (mode == BFS_BOTTOM_UP_ONLY) ||
+                             (mode == BFS_AUTO && scout > edgesToCheck / BFS_ALPHA);
+
+            if (!goBottomUp)
+            {
+                double levelStart = nowSeconds();
+                edgesToCheck -= scout;
+                parallelRun(threads, topDownWorker, &context);
+                scout = gatherQueue(&context, threads);
+                if (context.queueSize > 0)
+                    recordLevel(result, &levelCapacity, 0, context.queueSize, nowSeconds() - levelStart);
+                continue;
+            }
+
+            // Stay bottom-up while the frontier grows or is still large
+            queueToBitmap(&context);
+            long long awake = context.queueSize;
+            long long oldAwake;
+            do
+            {
+                double levelStart = nowSeconds();
+                oldAwake = awake;
+                edgesToCheck -= scout;          // this frontier's edges get explored
+                parallelRun(threads, bottomUpWorker, &context);
+                awake = 0;
+                scout = 0;
+                for (int t = 0; t < threads; t++)
+                {
+                    awake += context.localAwake[t];
+                    scout += context.localScout[t];
+                }
+
+                unsigned long long *temp = context.frontier;
+                context.frontier = context.next;
+                context.next = temp;
+
+                if (awake > 0)
+                    recordLevel(result, &levelCapacity, 1, awake, nowSeconds() - levelStart);
+            } while (awake > 0 &&
+                     (mode == BFS_BOTTOM_UP_ONLY || awake >= oldAwake || awake > n / BFS_BETA));
+
+            scout = bitmapToQueue(&context);
+        }
+
+        result->parent = context.parent;
+        result->seconds = nowSeconds() - start;
+    }
+
+    free(context.queue);
+    free(context.frontier);
+    free(context.next);
+    for (int t = 0; context.localNext != NULL && t < threads; t++)
+        free(context.localNext[t]);
+    free(context.localNext);
+    free(context.localCount);
+    free(context.localCapacity);
+    free(context.localScout);
+    free(context.localAwake);
+
+    return result;
+}
+
+void freeBFSResult(BFSResult *result)
+{
+    if (result == NULL)
+        return;
+    free(result->parent);
+    free(result->levels);
+    free(result);
+}
+
+/*
+ * bfsPrintLevels - One line per level: direction, frontier size, time
+ */
+void bfsPrintLevels(const BFSResult *result)
+{
+    for (int i = 0; i < result->levelCount; i++)
+    {
+        printf("    level %3d  %-9s  frontier %10lld  %8.3f ms\n", i,
+               result->levels[i].bottomUp ? "bottom-up" : "top-down",
+               result->levels[i].frontier, result->levels[i].seconds * 1e3);
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef BFS_H
+#define BFS_H
+
+#include "csr_graph.h"
+
+/*
+ * ============================================================================
+ * DIRECTION-OPTIMIZING BREADTH-FIRST SEARCH (Beamer et al.)
+ * ============================================================================
+ *
+ * Top-down step:  for every u in the frontier queue, claim each unvisited
+ *                 neighbor v (CAS on parent[v]).  Cost ~ edges out of the
+ *                 frontier -> good while the frontier is small.
+ *
+ * Bottom-up step: for every unvisited v, scan its neighbors and stop at the
+ *                 first one whose bit is set in the frontier bitmap.
+ *                 Cost ~ edges of unvisited vertices, but most scans stop
+ *                 early -> good when the frontier is a big part of the graph.
+ *
+ * Switching (alpha = 15, beta = 18, as in the paper):
+ *   top-down -> bottom-up  when edges out of the frontier > unexplored edges / alpha
+ *   bottom-up -> top-down  when the frontier shrinks below n / beta
+ *
+ * The graph must be symmetric (csrFromEdges with symmetrize = 1) because
+ * the bottom-up step reads neighbor lists as in-neighbor lists.
+ * ============================================================================
+ */
+
+#define BFS_ALPHA 15
+#define BFS_BETA 18
+
+typedef enum BFSMode
+{
+    BFS_AUTO,               // direction-optimizing
+    BFS_TOP_DOWN_ONLY,
+    BFS_BOTTOM_UP_ONLY
+} BFSMode;
+
+typedef struct BFSLevel
+{
+    int bottomUp;           // 1 if this level ran bottom-up
+    long long frontier;     // vertices discovered at this level
+    double seconds;
+} BFSLevel;
+
+typedef struct BFSResult
+{
+    int *parent;            // parent[v], source is its own parent, -1 = unreached
+    long long visited;
+    int levelCount;
+    BFSLevel *levels;
+    double seconds;
+} BFSResult;
+
+BFSResult *bfs(const CSRGraph *graph, int source, int threads, BFSMode mode);
+void freeBFSResult(BFSResult *result);
+void bfsPrintLevels(const BFSResult *result);
+
+#endif
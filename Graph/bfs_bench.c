@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bfs.h"
+#include "graph_gen.h"
+#include "parallel.h"
+
+/*
+ * Test driver / benchmark for bfs.c
+ *
+ * Every result is validated against a plain sequential queue BFS: each
+ * reached vertex's parent must be a neighbor exactly one level closer to
+ * the source. Speed is reported in MTEPS (million traversed edges per
+ * second, counting the undirected edges inside the reached component).
+ *
+ * Build: gcc -O2 -pthread parallel.c graph_gen.c csr_graph.c bfs.c bfs_bench.c -o bfs
+ * Usage: ./bfs [scale] [edgeFactor] [threads] [sources]
+ *        ./bfs --cache <file.csr> [threads] [sources]
+ */
+
+/*
+ * referenceDepths - Sequential BFS with a preallocated n-slot queue
+ */
+static int *referenceDepths(const CSRGraph *graph, int source)
+{
+    int *depth = (int *)malloc(graph->n * sizeof(int));
+    int *queue = (int *)malloc(graph->n * sizeof(int));
+    for (int v = 0; v < graph->n; v++)
+        depth[v] = -1;
+
+    int front = 0, rear = 0;
+    depth[source] = 0;
+    queue[rear++] = source;
+    while (front < rear)
+    {
+        int u = queue[front++];
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++)
+        {
+            int v = graph->neighbors[e];
+            if (depth[v] == -1)
+            {
+                depth[v] = depth[u] + 1;
+                queue[rear++] = v;
+            }
+        }
+    }
+
+    free(queue);
+    return depth;
+}
+
+static int validate(const CSRGraph *graph, const BFSResult *result, const int *depth, int source)
+{
+    for (int v = 0; v < graph->n; v++)
+    {
+        int p = result->parent[v];
+        if ((p == -1) != (depth[v] == -1))
+            return 0;
+        if (p == -1 || v == source)
+            continue;
+        if (depth[p] != depth[v] - 1)
+            return 0;
+
+        int isNeighbor = 0;
+        for (long long e = graph->offsets[v]; e < graph->offsets[v + 1] && !isNeighbor; e++)
+            isNeighbor = (graph->neighbors[e] == p);
+        if (!isNeighbor)
+            return 0;
+    }
+    return result->parent[source] == source;
+}
+
+int main(int argc, char **argv)
+{
+    CSRGraph *graph;
+    int threads, sources;
+
+    if (argc > 2 && strcmp(argv[1], "--cache") == 0)
+    {
+        graph = csrLoadCache(argv[2]);
+        threads = (argc > 3) ? atoi(argv[3]) : defaultThreadCount();
+        sources = (argc > 4) ? atoi(argv[4]) : 4;
+        if (graph == NULL)
+            return 1;
+        printf("%s: %d vertices, %lld arcs, %d threads\n", argv[2], graph->n, graph->m, threads);
+    }
+    else
+    {
+        int scale = (argc > 1) ? atoi(argv[1]) : 20;
+        int edgeFactor = (argc > 2) ? atoi(argv[2]) : 16;
+        threads = (argc > 3) ? atoi(argv[3]) : defaultThreadCount();
+        sources = (argc > 4) ? atoi(argv[4]) : 4;
+
+        long long m = (long long)edgeFactor << scale;
+        Edge *edges = generateRMATEdges(scale, m, 1);
+        graph = csrFromEdges(edges, m, 1 << scale, 1, threads);
+        free(edges);
+        if (graph == NULL)
+            return 1;
+        printf("R-MAT scale %d: %d vertices, %lld arcs, %d threads\n", scale, graph->n, graph->m, threads);
+    }
+
+    const char *modeNames[] = {"direction-optimizing", "top-down only", "bottom-up only"};
+    int allOk = 1;
+    unsigned int pick = 12345;
+
+    for (int s = 0; s < sources; s++)
+    {
+        // Pick a source with at least one neighbor
+        int source;
+        do
+        {
+            pick = pick * 1103515245u + 12345u;
+            source = (int)(pick % graph->n);
+        } while (csrDegree(graph, source) == 0);
+
+        int *depth = referenceDepths(graph, source);
+        long long componentArcs = 0;
+        for (int v = 0; v < graph->n; v++)
+        {
+            if (depth[v] != -1)
+                componentArcs += csrDegree(graph, v);
+        }
+
+        printf("\nsource %d:\n", source);
+        for (int mode = BFS_AUTO; mode <= BFS_BOTTOM_UP_ONLY; mode++)
+        {
+            BFSResult *result = bfs(graph, source, threads, (BFSMode)mode);
+            int ok = validate(graph, result, depth, source);
+            allOk = allOk && ok;
+
+            printf("  %-22s %8.3f ms  %8.1f MTEPS  visited %lld  %s\n", modeNames[mode],
+                   result->seconds * 1e3, componentArcs / 2 / result->seconds / 1e6,
+                   result->visited, ok ? "OK" : "INVALID");
+            if (mode == BFS_AUTO && s == 0)
+                bfsPrintLevels(result);
+            freeBFSResult(result);
+        }
+        free(depth);
+    }
+
+    freeCSRGraph(graph);
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,248 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "concurrent_union_find.h"
+#include "parallel.h"
+
+#define CC_BLOCK_EDGES 16384
+
+/*
+ * priority - Fixed pseudo-random priority of a vertex (murmur3 finalizer)
+ *
+ * Linking toward the higher priority behaves like linking by random rank,
+ * which keeps expected tree height logarithmic without a rank array.
+ */
+static unsigned int priority(int v)
+{
+    unsigned int h = (unsigned int)v;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/*
+ * lowerPriority - 1 if u must be linked under v (ties broken by id)
+ */
+static int lowerPriority(int u, int v)
+{
+    unsigned int pu = priority(u);
+    unsigned int pv = priority(v);
+    return (pu != pv) ? (pu < pv) : (u < v);
+}
+
+/*
+ * createConcurrentUnionFind - Creates n singleton sets
+ *
+ * Returns: pointer to the structure, or NULL if allocation failed
+ */
+ConcurrentUnionFind *createConcurrentUnionFind(int n)
+{
+    ConcurrentUnionFind *uf = (ConcurrentUnionFind *)malloc(sizeof(ConcurrentUnionFind));
+    if (uf == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    uf->parent = (atomic_int *)malloc(n * sizeof(atomic_int));
+    if (uf->parent == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(uf);
+        return NULL;
+    }
+
+    for (int v = 0; v < n; v++)
+        atomic_init(&uf->parent[v], v);
+    atomic_init(&uf->components, n);
+    uf->n = n;
+
+    return uf;
+}
+
+void freeConcurrentUnionFind(ConcurrentUnionFind *uf)
+{
+    if (uf == NULL)
+        return;
+    free(uf->parent);
+    free(uf);
+}
+
+/*
+ * cufFind - Returns the current root of v, halving the path with CAS
+ *
+ * Safe to call concurrently with other finds and unions. The root can
+ * change right after return if another thread links it; callers that
+ * need a stable answer re-check (see cufUnion / cufConnected).
+ *
+ * Time Complexity: O(log n) expected, near O(α(n)) amortized in practice
+ */
+int cufFind(ConcurrentUnionFind *uf, int v)
+{
+    atomic_int *parent = uf->parent;
+
+    for (;;)
+    {
+        int p = atomic_load_explicit(&parent[v], memory_order_relaxed);
+        if (p == v)
+            return v;
+
+        int gp = atomic_load_explicit(&parent[p], memory_order_relaxed);
+        if (gp != p)
+        {
+            // Try to skip p; losing the race is harmless
+            atomic_compare_exchange_weak_explicit(&parent[v], &p, gp,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed);
+        }
+        v = gp;
+    }
+}
+
+/*
+ * cufUnion - Merges the sets of u and v
+ *
+ * Returns: 1 if this call linked two sets, 0 if they were already one
+ *
+ * Lock-free: a CAS only fails if another thread made progress.
+ */
+int cufUnion(ConcurrentUnionFind *uf, int u, int v)
+{
+    for (;;)
+    {
+        int rootu = cufFind(uf, u);
+        int rootv = cufFind(uf, v);
+
+        if (rootu == rootv)
+            return 0;
+
+        if (!lowerPriority(rootu, rootv))
+        {
+            int temp = rootu;
+            rootu = rootv;
+            rootv = temp;
+        }
+
+        // Link rootu under rootv, but only if rootu is still a root
+        int expected = rootu;
+        if (atomic_compare_exchange_strong_explicit(&uf->parent[rootu], &expected, rootv,
+                                                    memory_order_acq_rel,
+                                                    memory_order_relaxed))
+        {
+            atomic_fetch_sub_explicit(&uf->components, 1, memory_order_relaxed);
+            return 1;
+        }
+        u = rootu;
+        v = rootv;
+    }
+}
+
+/*
+ * cufConnected - 1 if u and v are in the same set at some instant during
+ * the call, 0 otherwise
+ */
+int cufConnected(ConcurrentUnionFind *uf, int u, int v)
+{
+    for (;;)
+    {
+        int rootu = cufFind(uf, u);
+        int rootv = cufFind(uf, v);
+
+        if (rootu == rootv)
+            return 1;
+
+        // rootu still a root: u and v really were apart
+        if (atomic_load_explicit(&uf->parent[rootu], memory_order_acquire) == rootu)
+            return 0;
+    }
+}
+
+typedef struct ComponentsJob
+{
+    ConcurrentUnionFind *uf;
+    const Edge *edges;
+    long long edgeCount;
+    atomic_llong nextBlock;     // shared work counter, in edges
+    int *labels;
+} ComponentsJob;
+
+/*
+ * uniteWorker - Thread body: grab blocks of edges until none are left
+ *
+ * Blocks are handed out dynamically so threads that hit many already
+ * connected edges (cheap) take more blocks than threads doing links.
+ */
+static void uniteWorker(void *arg, int thread, int threads)
+{
+    (void)thread;
+    (void)threads;
+    ComponentsJob *job = (ComponentsJob *)arg;
+
+    for (;;)
+    {
+        long long first = atomic_fetch_add_explicit(&job->nextBlock, CC_BLOCK_EDGES,
+                                                    memory_order_relaxed);
+        if (first >= job->edgeCount)
+            break;
+
+        long long last = first + CC_BLOCK_EDGES;
+        if (last > job->edgeCount)
+            last = job->edgeCount;
+
+        for (long long e = first; e < last; e++)
+            cufUnion(job->uf, job->edges[e].u, job->edges[e].v);
+    }
+}
+
+/*
+ * labelWorker - Thread body: labels[v] = root of v for a slice of vertices
+ */
+static void labelWorker(void *arg, int thread, int threads)
+{
+    ComponentsJob *job = (ComponentsJob *)arg;
+    long long first, last;
+    threadRange(job->uf->n, thread, threads, &first, &last);
+
+    for (long long v = first; v < last; v++)
+        job->labels[v] = cufFind(job->uf, (int)v);
+}
+
+/*
+ * connectedComponents - Parallel connected components of an edge list
+ * @edges: edgeCount undirected edges over vertices 0 .. n-1
+ * @threads: number of worker threads
+ * @labels: output, labels[v] = representative vertex of v's component
+ *          (may be NULL if only the count is needed)
+ *
+ * Returns: number of components, or -1 on allocation failure
+ *
+ * Time Complexity: O((n + m) α(n)) total work, split across threads
+ */
+int connectedComponents(const Edge *edges, long long edgeCount, int n,
+                        int threads, int *labels)
+{
+    ConcurrentUnionFind *uf = createConcurrentUnionFind(n);
+    if (uf == NULL)
+        return -1;
+
+    if (threads < 1)
+        threads = 1;
+
+    ComponentsJob job;
+    job.uf = uf;
+    job.edges = edges;
+    job.edgeCount = edgeCount;
+    atomic_init(&job.nextBlock, 0);
+    job.labels = labels;
+
+    // parallelRun checks thread creation and runs what could not start
+    parallelRun(threads, uniteWorker, &job);
+    if (labels != NULL)
+        parallelRun(threads, labelWorker, &job);
+
+    int components = atomic_load(&uf->components);
+    freeConcurrentUnionFind(uf);
+    return components;
+}
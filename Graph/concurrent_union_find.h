@@ -0,0 +1,46 @@
+#ifndef CONCURRENT_UNION_FIND_H
+#define CONCURRENT_UNION_FIND_H
+
+#include <stdatomic.h>
+#include "edge.h"
+
+/*
+ * ============================================================================
+ * LOCK-FREE CONCURRENT UNION-FIND
+ * ============================================================================
+ *
+ * Same flat parent[] idea as union_find.c, but every slot is atomic so any
+ * number of threads can call cufFind / cufUnion at the same time
+ * (Jayanti-Tarjan style):
+ *
+ *   find:  path halving, where each "parent[v] = grandparent" is a CAS.
+ *          A failed CAS just means another thread already improved the
+ *          pointer, so it is ignored.
+ *   union: find both roots, then CAS parent[low] from low to high, where
+ *          low/high are ordered by a fixed hash priority of the vertex id
+ *          (randomized linking). If the CAS fails, low stopped being a
+ *          root in the meantime, so retry from the new roots.
+ *
+ * Only roots are ever linked, and always toward a higher priority, so no
+ * cycle can form and no locks are needed.
+ * ============================================================================
+ */
+
+typedef struct ConcurrentUnionFind
+{
+    atomic_int *parent;
+    atomic_int components;
+    int n;
+} ConcurrentUnionFind;
+
+ConcurrentUnionFind *createConcurrentUnionFind(int n);
+void freeConcurrentUnionFind(ConcurrentUnionFind *uf);
+
+int cufFind(ConcurrentUnionFind *uf, int v);
+int cufUnion(ConcurrentUnionFind *uf, int u, int v);
+int cufConnected(ConcurrentUnionFind *uf, int u, int v);
+
+int connectedComponents(const Edge *edges, long long edgeCount, int n,
+                        int threads, int *labels);
+
+#endif
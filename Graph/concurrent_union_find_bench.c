@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "union_find.h"
+#include "concurrent_union_find.h"
+
+/*
+ * Test driver / scaling benchmark for concurrent_union_find.c
+ *
+ * Runs connectedComponents on a random edge list with 1, 2, 4, ... threads
+ * and checks every result against the sequential UnionFind.
+ *
+ * Build: gcc -O2 -pthread parallel.c union_find.c concurrent_union_find.c concurrent_union_find_bench.c -o cuf
+ * Usage: ./cuf [vertices] [edges] [maxThreads]
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+    int n = (argc > 1) ? atoi(argv[1]) : 4000000;
+    long long m = (argc > 2) ? atoll(argv[2]) : 32000000LL;
+    int maxThreads = (argc > 3) ? atoi(argv[3]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    Edge *edges = (Edge *)malloc(m * sizeof(Edge));
+    int *labels = (int *)malloc(n * sizeof(int));
+    if (edges == NULL || labels == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+
+    // Sparse random graph; v is drawn from the lower half of the ids so
+    // degrees are skewed and some vertices stay isolated
+    unsigned long long state = 0x9E3779B97F4A7C15ULL;
+    for (long long e = 0; e < m; e++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        edges[e].u = (int)(state % n);
+        edges[e].v = (int)((state >> 32) % (n / 2 + 1));
+    }
+
+    // Sequential reference
+    double start = nowSeconds();
+    UnionFind *reference = createUnionFind(n);
+    for (long long e = 0; e < m; e++)
+        ufUnion(reference, edges[e].u, edges[e].v);
+    double sequentialTime = nowSeconds() - start;
+    printf("%d vertices, %lld edges\n", n, m);
+    printf("  sequential UnionFind : %6.2f s  %7.1f M edges/s  components=%d\n",
+           sequentialTime, m / sequentialTime / 1e6, ufComponentCount(reference));
+
+    int threadCounts = maxThreads < 4 ? 4 : maxThreads;
+    for (int threads = 1; threads <= threadCounts; threads *= 2)
+    {
+        start = nowSeconds();
+        int components = connectedComponents(edges, m, n, threads, labels);
+        double elapsed = nowSeconds() - start;
+
+        // Same partition as the reference?
+        int ok = (components == ufComponentCount(reference));
+        for (long long e = 0; ok && e < m; e++)
+            ok = (labels[edges[e].u] == labels[edges[e].v]);
+        for (int v = 0; ok && v < n; v++)
+            ok = (labels[v] == labels[labels[v]]) &&
+                 (ufFind(reference, v) == ufFind(reference, labels[v]));
+
+        printf("  concurrent, %2d thread%s: %6.2f s  %7.1f M edges/s  components=%d  %s\n",
+               threads, threads == 1 ? " " : "s", elapsed, m / elapsed / 1e6, components,
+               ok ? "OK" : "MISMATCH");
+    }
+
+    freeUnionFind(reference);
+    free(edges);
+    free(labels);
+    return 0;
+}
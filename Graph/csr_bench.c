@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "csr_graph.h"
+#include "graph_gen.h"
+#include "parallel.h"
+
+/*
+ * Test driver / benchmark for csr_graph.c
+ *
+ * Writes an R-MAT edge list as text and as binary, loads both, saves the
+ * binary CSR cache, reloads it and checks all four graphs are identical.
+ *
+ * Build: gcc -O2 -pthread parallel.c graph_gen.c csr_graph.c csr_bench.c -o csr
+ * Usage: ./csr [scale] [edgeFactor] [threads] [tempDir]
+ *        ./csr --load <edge list file> [threads]     (text, symmetrized)
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int sameGraph(const CSRGraph *a, const CSRGraph *b)
+{
+    if (a == NULL || b == NULL || a->n != b->n || a->m != b->m)
+        return 0;
+    if ((a->weights == NULL) != (b->weights == NULL))
+        return 0;
+    if (memcmp(a->offsets, b->offsets, (a->n + 1) * sizeof(long long)) != 0)
+        return 0;
+    if (memcmp(a->neighbors, b->neighbors, a->m * sizeof(int)) != 0)
+        return 0;
+    return a->weights == NULL || memcmp(a->weights, b->weights, a->m * sizeof(int)) == 0;
+}
+
+int main(int argc, char **argv)
+{
+    // ---- Small demo: the graph from csr_graph.h ----
+    Edge small[] = {{0, 1}, {0, 2}, {1, 2}, {2, 0}, {2, 3}};
+    CSRGraph *graph = csrFromEdges(small, 5, 4, 0, 1);
+    printf("offsets:   ");
+    for (int v = 0; v <= graph->n; v++)
+        printf("%lld ", graph->offsets[v]);
+    printf("\nneighbors: ");
+    for (long long e = 0; e < graph->m; e++)
+        printf("%d ", graph->neighbors[e]);
+    printf("\n\n");             // Expected: 0 2 3 5 5 / 1 2 2 0 3
+    freeCSRGraph(graph);
+
+    if (argc > 2 && strcmp(argv[1], "--load") == 0)
+    {
+        int threads = (argc > 3) ? atoi(argv[3]) : defaultThreadCount();
+        double start = nowSeconds();
+        graph = csrLoadTextEdgeList(argv[2], 0, 1, threads);
+        if (graph == NULL)
+            return 1;
+        printf("Loaded %s: %d vertices, %lld arcs in %.2f s\n", argv[2], graph->n, graph->m,
+               nowSeconds() - start);
+        freeCSRGraph(graph);
+        return 0;
+    }
+
+    int scale = (argc > 1) ? atoi(argv[1]) : 20;
+    int edgeFactor = (argc > 2) ? atoi(argv[2]) : 16;
+    int threads = (argc > 3) ? atoi(argv[3]) : defaultThreadCount();
+    const char *tempDir = (argc > 4) ? argv[4] : "/tmp";
+    long long m = (long long)edgeFactor << scale;
+
+    Edge *edges = generateRMATEdges(scale, m, 42);
+    WeightedEdge *weighted = addRandomWeights(edges, m, 100, 7);
+    if (edges == NULL || weighted == NULL)
+        return 1;
+
+    char textPath[300], binaryPath[300], cachePath[300];
+    snprintf(textPath, sizeof(textPath), "%s/csr_bench_edges.txt", tempDir);
+    snprintf(binaryPath, sizeof(binaryPath), "%s/csr_bench_edges.bin", tempDir);
+    snprintf(cachePath, sizeof(cachePath), "%s/csr_bench.csr", tempDir);
+
+    FILE *text = fopen(textPath, "w");
+    FILE *binary = fopen(binaryPath, "wb");
+    if (text == NULL || binary == NULL)
+    {
+        perror("fopen");
+        return 1;
+    }
+    fprintf(text, "# R-MAT scale %d, u v w\n", scale);
+    for (long long e = 0; e < m; e++)
+        fprintf(text, "%d %d %d\n", weighted[e].u, weighted[e].v, weighted[e].w);
+    fwrite(weighted, sizeof(WeightedEdge), m, binary);
+    fclose(text);
+    fclose(binary);
+
+    printf("R-MAT scale %d: %lld edges, %d threads\n", scale, m, threads);
+
+    double start = nowSeconds();
+    CSRGraph *fromMemory = csrFromWeightedEdges(weighted, m, 1 << scale, 1, threads);
+    printf("  from memory   : %6.3f s\n", nowSeconds() - start);
+
+    start = nowSeconds();
+    CSRGraph *fromText = csrLoadTextEdgeList(textPath, 1, 1, threads);
+    printf("  text loader   : %6.3f s\n", nowSeconds() - start);
+
+    start = nowSeconds();
+    CSRGraph *fromBinary = csrLoadBinaryEdgeList(binaryPath, 1, 1, threads);
+    printf("  binary loader : %6.3f s\n", nowSeconds() - start);
+
+    start = nowSeconds();
+    csrSaveCache(fromBinary, cachePath);
+    printf("  cache save    : %6.3f s\n", nowSeconds() - start);
+
+    start = nowSeconds();
+    CSRGraph *fromCache = csrLoadCache(cachePath);
+    double cacheTime = nowSeconds() - start;
+
+    // Touch every arc so the comparison below includes page-in cost
+    long long checksum = 0;
+    double touchStart = nowSeconds();
+    for (long long e = 0; fromCache != NULL && e < fromCache->m; e++)
+        checksum += fromCache->neighbors[e];
+    double touchTime = nowSeconds() - touchStart;
+    printf("  cache load    : %6.3f s (mmap), %.3f s to touch all %lld arcs (checksum %lld)\n",
+           cacheTime, touchTime, fromCache != NULL ? fromCache->m : 0, checksum);
+
+    // R-MAT leaves some high ids unused, so compare against the memory
+    // build only after trimming it to the loaders' n
+    int ok = sameGraph(fromText, fromBinary) && sameGraph(fromBinary, fromCache) &&
+             fromMemory->offsets[fromBinary->n] == fromMemory->m &&
+             memcmp(fromMemory->neighbors, fromBinary->neighbors, fromBinary->m * sizeof(int)) == 0;
+    printf("  text == binary == cache == memory: %s\n", ok ? "OK" : "MISMATCH");
+
+    freeCSRGraph(fromMemory);
+    freeCSRGraph(fromText);
+    freeCSRGraph(fromBinary);
+    freeCSRGraph(fromCache);
+    free(edges);
+    free(weighted);
+    remove(textPath);
+    remove(binaryPath);
+    remove(cachePath);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,872 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "csr_graph.h"
+#include "parallel.h"
+
+#define SORT_BLOCK_VERTICES 1024
+
+/*
+ * createCSRGraph - Allocates a graph with room for n vertices and m arcs
+ * @weighted: 1 to also allocate weights[]
+ *
+ * offsets[] is zeroed; neighbors[] / weights[] are left for the caller.
+ *
+ * Returns: pointer to the graph, or NULL if allocation failed
+ */
+CSRGraph *createCSRGraph(int n, long long m, int weighted)
+{
+    CSRGraph *graph = (CSRGraph *)calloc(1, sizeof(CSRGraph));
+    if (graph == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    graph->n = n;
+    graph->m = m;
+    graph->offsets = (long long *)calloc((size_t)n + 1, sizeof(long long));
+    graph->neighbors = (int *)malloc((m > 0 ? m : 1) * sizeof(int));
+    graph->weights = weighted ? (int *)malloc((m > 0 ? m : 1) * sizeof(int)) : NULL;
+
+    if (graph->offsets == NULL || graph->neighbors == NULL || (weighted && graph->weights == NULL))
+    {
+        printf("Memory allocation failed!\n");
+        freeCSRGraph(graph);
+        return NULL;
+    }
+
+    return graph;
+}
+
+/*
+ * freeCSRGraph - Releases a graph, whether heap-allocated or mmap'd
+ */
+void freeCSRGraph(CSRGraph *graph)
+{
+    if (graph == NULL)
+        return;
+
+    if (graph->mapping != NULL)
+    {
+        munmap(graph->mapping, graph->mappingBytes);
+    }
+    else
+    {
+        free(graph->offsets);
+        free(graph->neighbors);
+        free(graph->weights);
+    }
+    free(graph);
+}
+
+long long csrDegree(const CSRGraph *graph, int v)
+{
+    return graph->offsets[v + 1] - graph->offsets[v];
+}
+
+/* ------------------------------------------------------------------------ */
+/* Neighbor sorting                                                         */
+/* ------------------------------------------------------------------------ */
+
+typedef struct NeighborPair
+{
+    int v;
+    int w;
+} NeighborPair;
+
+static int compareInts(const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static int comparePairs(const void *a, const void *b)
+{
+    const NeighborPair *x = (const NeighborPair *)a;
+    const NeighborPair *y = (const NeighborPair *)b;
+    if (x->v != y->v)
+        return (x->v > y->v) - (x->v < y->v);
+    return (x->w > y->w) - (x->w < y->w);
+}
+
+typedef struct SortContext
+{
+    CSRGraph *graph;
+    long long nextBlock;    // shared work counter, in vertices
+} SortContext;
+
+/*
+ * sortWorker - Sorts the neighbor lists of blocks of vertices
+ *
+ * Blocks are handed out dynamically because a few hub vertices can hold
+ * most of the arcs.
+ */
+static void sortWorker(void *arg, int thread, int threads)
+{
+    (void)thread;
+    (void)threads;
+    SortContext *context = (SortContext *)arg;
+    CSRGraph *graph = context->graph;
+    NeighborPair *pairs = NULL;
+    long long pairCapacity = 0;
+
+    for (;;)
+    {
+        long long first = __atomic_fetch_add(&context->nextBlock, SORT_BLOCK_VERTICES, __ATOMIC_RELAXED);
+        if (first >= graph->n)
+            break;
+        long long last = first + SORT_BLOCK_VERTICES;
+        if (last > graph->n)
+            last = graph->n;
+
+        for (long long v = first; v < last; v++)
+        {
+            long long begin = graph->offsets[v];
+            long long degree = graph->offsets[v + 1] - begin;
+            if (degree < 2)
+                continue;
+
+            if (graph->weights == NULL)
+            {
+                qsort(graph->neighbors + begin, degree, sizeof(int), compareInts);
+                continue;
+            }
+
+            // Weighted: sort (neighbor, weight) together
+            if (degree > pairCapacity)
+            {
+                free(pairs);
+                pairCapacity = degree;
+                pairs = (NeighborPair *)malloc(pairCapacity * sizeof(NeighborPair));
+                if (pairs == NULL)
+                {
+                    printf("Memory allocation failed!\n");
+                    exit(1);
+                }
+            }
+            for (long long i = 0; i < degree; i++)
+            {
+                pairs[i].v = graph->neighbors[begin + i];
+                pairs[i].w = graph->weights[begin + i];
+            }
+            qsort(pairs, degree, sizeof(NeighborPair), comparePairs);
+            for (long long i = 0; i < degree; i++)
+            {
+                graph->neighbors[begin + i] = pairs[i].v;
+                graph->weights[begin + i] = pairs[i].w;
+            }
+        }
+    }
+
+    free(pairs);
+}
+
+/*
+ * csrSortNeighbors - Sorts every adjacency list in ascending order
+ *
+ * Parallel fill leaves lists in arbitrary order; sorted lists make the
+ * graph deterministic and allow merge-style intersections.
+ */
+void csrSortNeighbors(CSRGraph *graph, int threads)
+{
+    SortContext context;
+    context.graph = graph;
+    context.nextBlock = 0;
+    parallelRun(threads, sortWorker, &context);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Two-pass count / fill construction                                       */
+/* ------------------------------------------------------------------------ */
+
+/*
+ * claimSlot - cursor++, atomically only when other threads share it
+ *
+ * A locked increment drains the store buffer, so a fill that alternates
+ * atomic increments with scattered stores stalls on every store miss
+ * (about 5x slower single-threaded than a plain increment).
+ */
+static long long claimSlot(long long *cursor, int shared)
+{
+    if (!shared)
+        return (*cursor)++;
+    return __atomic_fetch_add(cursor, 1, __ATOMIC_RELAXED);
+}
+
+typedef struct BuildContext
+{
+    const int *fields;      // edge list as ints: u, v[, w] per edge
+    int stride;             // 2 = unweighted, 3 = weighted
+    long long edgeCount;
+    int n;
+    int symmetrize;
+    long long *offsets;
+    long long *cursor;
+    int *neighbors;
+    int *weights;
+} BuildContext;
+
+/*
+ * countWorker - Pass 1: degree of every vertex, into offsets[v + 1]
+ */
+static void countWorker(void *arg, int thread, int threads)
+{
+    BuildContext *context = (BuildContext *)arg;
+    long long first, last;
+    threadRange(context->edgeCount, thread, threads, &first, &last);
+
+    for (long long e = first; e < last; e++)
+    {
+        int u = context->fields[e * context->stride];
+        int v = context->fields[e * context->stride + 1];
+        if (u < 0 || u >= context->n || v < 0 || v >= context->n)
+            continue;
+
+        claimSlot(&context->offsets[u + 1], threads > 1);
+        if (context->symmetrize && u != v)
+            claimSlot(&context->offsets[v + 1], threads > 1);
+    }
+}
+
+/*
+ * fillWorker - Pass 2: place every arc at its vertex's next free slot
+ */
+static void fillWorker(void *arg, int thread, int threads)
+{
+    BuildContext *context = (BuildContext *)arg;
+    long long first, last;
+    threadRange(context->edgeCount, thread, threads, &first, &last);
+
+    for (long long e = first; e < last; e++)
+    {
+        const int *edge = context->fields + e * context->stride;
+        int u = edge[0];
+        int v = edge[1];
+        if (u < 0 || u >= context->n || v < 0 || v >= context->n)
+            continue;
+
+        long long slot = claimSlot(&context->cursor[u], threads > 1);
+        context->neighbors[slot] = v;
+        if (context->weights != NULL)
+            context->weights[slot] = edge[2];
+
+        if (context->symmetrize && u != v)
+        {
+            slot = claimSlot(&context->cursor[v], threads > 1);
+            context->neighbors[slot] = u;
+            if (context->weights != NULL)
+                context->weights[slot] = edge[2];
+        }
+    }
+}
+
+/*
+ * buildCSR - Builds a CSR graph from a flat int edge list
+ *
+ * Pass 1 counts degrees (atomic increments), a prefix sum turns them into
+ * offsets, pass 2 scatters arcs using a per-vertex cursor. Memory is
+ * offsets + cursor + neighbors (+ weights): nothing is allocated per edge.
+ * Edges with an endpoint outside [0, n) are skipped.
+ */
+static CSRGraph *buildCSR(const int *fields, int stride, long long edgeCount, int n,
+                          int symmetrize, int threads)
+{
+    CSRGraph *graph = (CSRGraph *)calloc(1, sizeof(CSRGraph));
+    long long *offsets = (long long *)calloc((size_t)n + 1, sizeof(long long));
+    long long *cursor = (long long *)malloc(((size_t)n + 1) * sizeof(long long));
+    if (graph == NULL || offsets == NULL || cursor == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(graph);
+        free(offsets);
+        free(cursor);
+        return NULL;
+    }
+
+    BuildContext context;
+    context.fields = fields;
+    context.stride = stride;
+    context.edgeCount = edgeCount;
+    context.n = n;
+    context.symmetrize = symmetrize;
+    context.offsets = offsets;
+    context.cursor = cursor;
+
+    parallelRun(threads, countWorker, &context);
+
+    for (int v = 0; v < n; v++)
+        offsets[v + 1] += offsets[v];
+    long long m = offsets[n];
+
+    memcpy(cursor, offsets, (size_t)n * sizeof(long long));
+    context.neighbors = (int *)malloc((m > 0 ? m : 1) * sizeof(int));
+    context.weights = (stride == 3) ? (int *)malloc((m > 0 ? m : 1) * sizeof(int)) : NULL;
+    if (context.neighbors == NULL || (stride == 3 && context.weights == NULL))
+    {
+        printf("Memory allocation failed!\n");
+        free(context.neighbors);
+        free(context.weights);
+        free(offsets);
+        free(cursor);
+        free(graph);
+        return NULL;
+    }
+
+    parallelRun(threads, fillWorker, &context);
+    free(cursor);
+
+    graph->n = n;
+    graph->m = m;
+    graph->offsets = offsets;
+    graph->neighbors = context.neighbors;
+    graph->weights = context.weights;
+
+    csrSortNeighbors(graph, threads);
+    return graph;
+}
+
+/*
+ * csrFromEdges - Builds a CSR graph from an in-memory edge list
+ * @symmetrize: 1 to store every edge in both directions (undirected)
+ *
+ * Time Complexity: O(n + m) plus neighbor sorting
+ */
+CSRGraph *csrFromEdges(const Edge *edges, long long edgeCount, int n, int symmetrize, int threads)
+{
+    return buildCSR((const int *)edges, 2, edgeCount, n, symmetrize, threads);
+}
+
+CSRGraph *csrFromWeightedEdges(const WeightedEdge *edges, long long edgeCount, int n,
+                               int symmetrize, int threads)
+{
+    return buildCSR((const int *)edges, 3, edgeCount, n, symmetrize, threads);
+}
+
+typedef struct TransposeContext
+{
+    const CSRGraph *graph;
+    long long *offsets;
+    long long *cursor;
+    CSRGraph *transpose;
+} TransposeContext;
+
+static void transposeCountWorker(void *arg, int thread, int threads)
+{
+    TransposeContext *context = (TransposeContext *)arg;
+    const CSRGraph *graph = context->graph;
+    long long first, last;
+    threadRange(graph->m, thread, threads, &first, &last);
+
+    for (long long e = first; e < last; e++)
+        claimSlot(&context->offsets[graph->neighbors[e] + 1], threads > 1);
+}
+
+static void transposeFillWorker(void *arg, int thread, int threads)
+{
+    TransposeContext *context = (TransposeContext *)arg;
+    const CSRGraph *graph = context->graph;
+    CSRGraph *transpose = context->transpose;
+    long long first, last;
+    threadRange(graph->n, thread, threads, &first, &last);
+
+    for (long long u = first; u < last; u++)
+    {
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++)
+        {
+            int v = graph->neighbors[e];
+            long long slot = claimSlot(&context->cursor[v], threads > 1);
+            transpose->neighbors[slot] = (int)u;
+            if (transpose->weights != NULL)
+                transpose->weights[slot] = graph->weights[e];
+        }
+    }
+}
+
+/*
+ * csrTranspose - Builds the reverse graph: arc u -> v becomes v -> u
+ *
+ * Same count / prefix sum / fill scheme as buildCSR, driven by the arcs
+ * of the input instead of an edge list. Weights are carried over.
+ *
+ * Returns: the transpose with sorted neighbor lists, or NULL
+ *
+ * Time Complexity: O(n + m) plus neighbor sorting
+ */
+CSRGraph *csrTranspose(const CSRGraph *graph, int threads)
+{
+    CSRGraph *transpose = createCSRGraph(graph->n, graph->m, graph->weights != NULL);
+    long long *cursor = (long long *)malloc(((size_t)graph->n + 1) * sizeof(long long));
+    if (transpose == NULL || cursor == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        freeCSRGraph(transpose);
+        free(cursor);
+        return NULL;
+    }
+
+    TransposeContext context;
+    context.graph = graph;
+    context.offsets = transpose->offsets;
+    context.cursor = cursor;
+    context.transpose = transpose;
+
+    parallelRun(threads, transposeCountWorker, &context);
+    for (int v = 0; v < graph->n; v++)
+        transpose->offsets[v + 1] += transpose->offsets[v];
+
+    memcpy(cursor, transpose->offsets, (size_t)graph->n * sizeof(long long));
+    parallelRun(threads, transposeFillWorker, &context);
+    free(cursor);
+
+    csrSortNeighbors(transpose, threads);
+    return transpose;
+}
+
+/* ------------------------------------------------------------------------ */
+/* File loaders                                                             */
+/* ------------------------------------------------------------------------ */
+
+/*
+ * mapFile - mmaps a whole file read-only
+ *
+ * Returns: the mapping (NULL for an empty file or on error), size in *bytes
+ */
+static void *mapFile(const char *path, size_t *bytes, int *failed)
+{
+    *bytes = 0;
+    *failed = 0;
+
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        perror(path);
+        *failed = 1;
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1)
+    {
+        perror(path);
+        close(fd);
+        *failed = 1;
+        return NULL;
+    }
+    *bytes = st.st_size;
+    if (*bytes == 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    void *map = mmap(NULL, *bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        perror("mmap");
+        *failed = 1;
+        return NULL;
+    }
+    madvise(map, *bytes, MADV_SEQUENTIAL);
+
+    return map;
+}
+
+typedef struct MaxIdContext
+{
+    const int *fields;
+    int stride;
+    long long edgeCount;
+    int *threadMax;
+} MaxIdContext;
+
+static void maxIdWorker(void *arg, int thread, int threads)
+{
+    MaxIdContext *context = (MaxIdContext *)arg;
+    long long first, last;
+    threadRange(context->edgeCount, thread, threads, &first, &last);
+
+    int best = -1;
+    for (long long e = first; e < last; e++)
+    {
+        const int *edge = context->fields + e * context->stride;
+        if (edge[0] > best)
+            best = edge[0];
+        if (edge[1] > best)
+            best = edge[1];
+    }
+    context->threadMax[thread] = best;
+}
+
+/*
+ * csrLoadBinaryEdgeList - Loads a raw int32 edge list file
+ * @weighted: 0 = (u, v) pairs, 1 = (u, v, w) triples
+ *
+ * The file is mmap'd and used directly as the edge array for both passes,
+ * so no copy of the edge list is ever made. n = largest id + 1.
+ */
+CSRGraph *csrLoadBinaryEdgeList(const char *path, int weighted, int symmetrize, int threads)
+{
+    size_t bytes;
+    int failed;
+    const int *fields = (const int *)mapFile(path, &bytes, &failed);
+    if (failed)
+        return NULL;
+
+    int stride = weighted ? 3 : 2;
+    long long edgeCount = bytes / (stride * sizeof(int));
+
+    int *threadMax = (int *)malloc((threads > 0 ? threads : 1) * sizeof(int));
+    if (threadMax == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        if (fields != NULL)
+            munmap((void *)fields, bytes);
+        return NULL;
+    }
+
+    MaxIdContext context = {fields, stride, edgeCount, threadMax};
+    parallelRun(threads, maxIdWorker, &context);
+    int n = 0;
+    for (int t = 0; t < (threads > 0 ? threads : 1); t++)
+    {
+        if (threadMax[t] + 1 > n)
+            n = threadMax[t] + 1;
+    }
+    free(threadMax);
+
+    CSRGraph *graph = buildCSR(fields, stride, edgeCount, n, symmetrize, threads);
+    if (fields != NULL)
+        munmap((void *)fields, bytes);
+    return graph;
+}
+
+typedef struct TextContext
+{
+    const char *data;
+    size_t bytes;
+    int stride;
+    long long *begin;       // per-thread byte range, newline aligned
+    long long *end;
+    long long *edges;       // pass 1: edges per thread, then write offset
+    int *threadMax;
+    int *fields;            // pass 2 destination (NULL in pass 1)
+} TextContext;
+
+/*
+ * parseRange - Parses "u v [w]" lines in data[begin .. end)
+ *
+ * Lines starting with '#' or '%' (SNAP / MatrixMarket comments), lines
+ * with too few numbers and lines with a negative vertex id are skipped.
+ * A '-' right before a digit makes the number negative, so weights may be
+ * negative. With out == NULL it only counts.
+ *
+ * Returns: number of edges parsed
+ */
+static long long parseRange(const char *data, long long begin, long long end,
+                            int stride, int *out, int *maxId)
+{
+    long long count = 0;
+    long long i = begin;
+    int best = -1;
+
+    while (i < end)
+    {
+        if (data[i] == '#' || data[i] == '%')
+        {
+            while (i < end && data[i] != '\n')
+                i++;
+            i++;
+            continue;
+        }
+
+        int values[3];
+        int found = 0;
+        while (i < end && data[i] != '\n')
+        {
+            int negative = data[i] == '-' && i + 1 < end && data[i + 1] >= '0' && data[i + 1] <= '9';
+            if (negative)
+                i++;
+            if (data[i] >= '0' && data[i] <= '9')
+            {
+                long long value = 0;
+                while (i < end && data[i] >= '0' && data[i] <= '9')
+                    value = value * 10 + (data[i++] - '0');
+                if (found < 3)
+                    values[found] = (int)(negative ? -value : value);
+                found++;
+            }
+            else
+            {
+                i++;
+            }
+        }
+        i++;    // skip '\n'
+
+        if (found < stride || values[0] < 0 || values[1] < 0)
+            continue;
+
+        if (out != NULL)
+        {
+            for (int f = 0; f < stride; f++)
+                out[count * stride + f] = values[f];
+        }
+        if (values[0] > best)
+            best = values[0];
+        if (values[1] > best)
+            best = values[1];
+        count++;
+    }
+
+    *maxId = best;
+    return count;
+}
+
+static void textCountWorker(void *arg, int thread, int threads)
+{
+    TextContext *context = (TextContext *)arg;
+    long long first, last;
+    threadRange(context->bytes, thread, threads, &first, &last);
+
+    // Align both ends to the start of a line
+    if (first > 0)
+    {
+        while (first < (long long)context->bytes && context->data[first - 1] != '\n')
+            first++;
+    }
+    if (last < (long long)context->bytes)
+    {
+        while (last < (long long)context->bytes && context->data[last - 1] != '\n')
+            last++;
+    }
+
+    context->begin[thread] = first;
+    context->end[thread] = last;
+    context->edges[thread] = (first < last)
+        ? parseRange(context->data, first, last, context->stride, NULL, &context->threadMax[thread])
+        : 0;
+    if (first >= last)
+        context->threadMax[thread] = -1;
+}
+
+static void textFillWorker(void *arg, int thread, int threads)
+{
+    (void)threads;
+    TextContext *context = (TextContext *)arg;
+    int unused;
+
+    if (context->begin[thread] < context->end[thread])
+        parseRange(context->data, context->begin[thread], context->end[thread], context->stride,
+                   context->fields + context->edges[thread] * context->stride, &unused);
+}
+
+/*
+ * loadText - Runs the two text passes once the per-thread arrays exist
+ */
+static CSRGraph *loadText(TextContext *context, int symmetrize, int threads)
+{
+    if (context->bytes > 0)
+        parallelRun(threads, textCountWorker, context);
+    else
+        memset(context->edges, 0, threads * sizeof(long long));
+
+    // Turn per-thread counts into write offsets
+    long long edgeCount = 0;
+    int n = 0;
+    for (int t = 0; t < threads; t++)
+    {
+        long long count = context->edges[t];
+        context->edges[t] = edgeCount;
+        edgeCount += count;
+        if (context->bytes > 0 && context->threadMax[t] + 1 > n)
+            n = context->threadMax[t] + 1;
+    }
+
+    context->fields = (int *)malloc((edgeCount > 0 ? edgeCount : 1) * context->stride * sizeof(int));
+    if (context->fields == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+    if (context->bytes > 0)
+        parallelRun(threads, textFillWorker, context);
+
+    return buildCSR(context->fields, context->stride, edgeCount, n, symmetrize, threads);
+}
+
+/*
+ * csrLoadTextEdgeList - Loads a whitespace separated "u v [w]" text file
+ *
+ * The mmap'd text is split into one newline-aligned byte range per
+ * thread. Pass 1 counts edges and the largest id per range, pass 2
+ * parses straight into one flat int array at each thread's offset,
+ * which then goes through the usual count/fill construction.
+ */
+CSRGraph *csrLoadTextEdgeList(const char *path, int weighted, int symmetrize, int threads)
+{
+    if (threads < 1)
+        threads = 1;
+
+    size_t bytes;
+    int failed;
+    const char *data = (const char *)mapFile(path, &bytes, &failed);
+    if (failed)
+        return NULL;
+
+    TextContext context;
+    context.data = data;
+    context.bytes = bytes;
+    context.stride = weighted ? 3 : 2;
+    context.begin = (long long *)malloc(threads * sizeof(long long));
+    context.end = (long long *)malloc(threads * sizeof(long long));
+    context.edges = (long long *)malloc(threads * sizeof(long long));
+    context.threadMax = (int *)malloc(threads * sizeof(int));
+    context.fields = NULL;
+
+    CSRGraph *graph = NULL;
+    if (context.begin == NULL || context.end == NULL || context.edges == NULL || context.threadMax == NULL)
+        printf("Memory allocation failed!\n");
+    else
+        graph = loadText(&context, symmetrize, threads);
+
+    if (data != NULL)
+        munmap((void *)data, bytes);
+    free(context.begin);
+    free(context.end);
+    free(context.edges);
+    free(context.threadMax);
+    free(context.fields);
+    return graph;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Binary CSR cache                                                         */
+/* ------------------------------------------------------------------------ */
+
+static size_t weightsOffset(long long n, long long m)
+{
+    size_t offset = sizeof(CSRCacheHeader) + (n + 1) * sizeof(long long) + m * sizeof(int);
+    return (offset + 7) & ~(size_t)7;
+}
+
+/*
+ * csrSaveCache - Writes the graph in the binary cache format
+ *
+ * Returns: 0 on success, -1 on failure
+ */
+int csrSaveCache(const CSRGraph *graph, const char *path)
+{
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+
+    CSRCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = CSR_CACHE_MAGIC;
+    header.version = CSR_CACHE_VERSION;
+    header.n = graph->n;
+    header.m = graph->m;
+    header.weighted = graph->weights != NULL;
+
+    int ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+             fwrite(graph->offsets, sizeof(long long), graph->n + 1, file) == (size_t)graph->n + 1 &&
+             fwrite(graph->neighbors, sizeof(int), graph->m, file) == (size_t)graph->m;
+
+    if (ok && graph->weights != NULL)
+    {
+        size_t written = sizeof(header) + (graph->n + 1) * sizeof(long long) + graph->m * sizeof(int);
+        char padding[8] = {0};
+        size_t padBytes = weightsOffset(graph->n, graph->m) - written;
+        ok = fwrite(padding, 1, padBytes, file) == padBytes &&
+             fwrite(graph->weights, sizeof(int), graph->m, file) == (size_t)graph->m;
+    }
+
+    if (fclose(file) != 0)
+        ok = 0;
+    if (!ok)
+        printf("Failed to write %s\n", path);
+
+    return ok ? 0 : -1;
+}
+
+/*
+ * csrLoadCache - Opens a cache file written by csrSaveCache
+ *
+ * The file is mmap'd and the graph's arrays point into the mapping, so
+ * loading costs one mmap plus a header check; pages are faulted in as
+ * kernels touch them. The returned graph is read-only.
+ *
+ * Returns: the graph, or NULL if the file is missing or not a valid cache
+ */
+CSRGraph *csrLoadCache(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        perror(path);
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1)
+    {
+        perror(path);
+        close(fd);
+        return NULL;
+    }
+    if ((size_t)st.st_size < sizeof(CSRCacheHeader))
+    {
+        printf("%s: not a CSR cache file\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        perror("mmap");
+        return NULL;
+    }
+
+    const CSRCacheHeader *header = (const CSRCacheHeader *)map;
+    size_t expected = header->weighted
+        ? weightsOffset(header->n, header->m) + header->m * sizeof(int)
+        : sizeof(CSRCacheHeader) + (header->n + 1) * sizeof(long long) + header->m * sizeof(int);
+
+    if (header->magic != CSR_CACHE_MAGIC || header->version != CSR_CACHE_VERSION ||
+        (size_t)st.st_size < expected)
+    {
+        printf("%s: not a CSR cache file\n", path);
+        munmap(map, st.st_size);
+        return NULL;
+    }
+
+    CSRGraph *graph = (CSRGraph *)calloc(1, sizeof(CSRGraph));
+    if (graph == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        munmap(map, st.st_size);
+        return NULL;
+    }
+
+    char *base = (char *)map;
+    graph->n = (int)header->n;
+    graph->m = header->m;
+    graph->offsets = (long long *)(base + sizeof(CSRCacheHeader));
+    graph->neighbors = (int *)(base + sizeof(CSRCacheHeader) + (header->n + 1) * sizeof(long long));
+    graph->weights = header->weighted ? (int *)(base + weightsOffset(header->n, header->m)) : NULL;
+    graph->mapping = map;
+    graph->mappingBytes = st.st_size;
+
+    return graph;
+}
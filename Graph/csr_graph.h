@@ -0,0 +1,71 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include <stddef.h>
+#include "edge.h"
+
+/*
+ * ============================================================================
+ * COMPRESSED SPARSE ROW (CSR) GRAPH
+ * ============================================================================
+ *
+ * All adjacency lists packed back to back in one array:
+ *
+ *   edges: 0-1, 0-2, 1-2, 2-0, 2-3            (directed)
+ *
+ *   offsets:   [0, 2, 3, 5, 5]                (n + 1 entries)
+ *   neighbors: [1, 2 | 2 | 0, 3]              (m entries)
+ *               v=0    v=1  v=2
+ *
+ *   neighbors of v = neighbors[offsets[v] .. offsets[v+1]-1]
+ *
+ * Two flat arrays, no per-vertex or per-edge allocation, and a scan of a
+ * vertex's neighbors is one sequential read. Neighbor lists are sorted.
+ * weights[] runs parallel to neighbors[] and is NULL for unweighted graphs.
+ *
+ * Binary cache file layout (native endian):
+ *   [CSRCacheHeader, 64 bytes][offsets][neighbors][pad to 8][weights]
+ * Loading it is one mmap; the arrays point straight into the mapping.
+ * ============================================================================
+ */
+
+#define CSR_CACHE_MAGIC 0x47525343u     // "CSRG"
+#define CSR_CACHE_VERSION 1
+
+typedef struct CSRGraph
+{
+    int n;                  // vertices 0 .. n-1
+    long long m;            // stored arcs (2x edges if symmetrized)
+    long long *offsets;
+    int *neighbors;
+    int *weights;           // NULL if unweighted
+    void *mapping;          // non-NULL when the arrays live in an mmap'd cache
+    size_t mappingBytes;
+} CSRGraph;
+
+typedef struct CSRCacheHeader
+{
+    unsigned int magic;
+    unsigned int version;
+    long long n;
+    long long m;
+    long long weighted;
+    char reserved[32];
+} CSRCacheHeader;
+
+CSRGraph *csrFromEdges(const Edge *edges, long long edgeCount, int n, int symmetrize, int threads);
+CSRGraph *csrFromWeightedEdges(const WeightedEdge *edges, long long edgeCount, int n,
+                               int symmetrize, int threads);
+CSRGraph *csrLoadTextEdgeList(const char *path, int weighted, int symmetrize, int threads);
+CSRGraph *csrLoadBinaryEdgeList(const char *path, int weighted, int symmetrize, int threads);
+CSRGraph *csrTranspose(const CSRGraph *graph, int threads);
+
+int csrSaveCache(const CSRGraph *graph, const char *path);
+CSRGraph *csrLoadCache(const char *path);
+
+CSRGraph *createCSRGraph(int n, long long m, int weighted);
+void freeCSRGraph(CSRGraph *graph);
+long long csrDegree(const CSRGraph *graph, int v);
+void csrSortNeighbors(CSRGraph *graph, int threads);
+
+#endif
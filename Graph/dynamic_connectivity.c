@@ -0,0 +1,269 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dynamic_connectivity.h"
+#include "rollback_union_find.h"
+
+/*
+ * OpenEdge - Hash slot: an edge key and its most recent unmatched add
+ */
+typedef struct OpenEdge
+{
+    unsigned long long key;     // (min << 32) | max, ~0 for an empty slot
+    long long latest;           // event index of the newest open add, -1 if none
+} OpenEdge;
+
+typedef struct TimeTree
+{
+    long long *counts;          // edges stored per node, then fill cursors
+    long long *offsets;         // node i's edges: items[offsets[i] .. offsets[i+1])
+    int *items;                 // lifetime indices
+    int leaves;
+} TimeTree;
+
+typedef struct SolveContext
+{
+    TimeTree *tree;
+    RollbackUnionFind *uf;
+    const int *lifeU;
+    const int *lifeV;
+    const DCEvent *events;
+    const long long *queryEvent;    // query index -> event index
+    int *answers;
+} SolveContext;
+
+static unsigned long long edgeKey(int u, int v)
+{
+    if (u > v)
+    {
+        int temp = u;
+        u = v;
+        v = temp;
+    }
+    return ((unsigned long long)u << 32) | (unsigned int)v;
+}
+
+static OpenEdge *lookup(OpenEdge *table, unsigned long long mask, unsigned long long key)
+{
+    unsigned long long slot = (key * 0x9E3779B97F4A7C15ULL) >> 20 & mask;
+
+    while (table[slot].key != ~0ULL && table[slot].key != key)
+        slot = (slot + 1) & mask;
+    return &table[slot];
+}
+
+/*
+ * cover - Visits the O(log Q) tree nodes whose ranges exactly tile
+ * [first, last); counts on the first pass, stores on the second
+ */
+static void cover(TimeTree *tree, int node, int lo, int hi, int first, int last,
+                  int life, int fill)
+{
+    if (last <= lo || hi <= first)
+        return;
+
+    if (first <= lo && hi <= last)
+    {
+        if (fill)
+            tree->items[tree->offsets[node] + tree->counts[node]++] = life;
+        else
+            tree->counts[node]++;
+        return;
+    }
+
+    int mid = lo + (hi - lo) / 2;
+    cover(tree, 2 * node, lo, mid, first, last, life, fill);
+    cover(tree, 2 * node + 1, mid, hi, first, last, life, fill);
+}
+
+/*
+ * solve - DFS over the time tree; the union-find holds exactly the edges
+ * alive throughout [lo, hi) when a node is entered
+ */
+static void solve(SolveContext *context, int node, int lo, int hi)
+{
+    TimeTree *tree = context->tree;
+    int snapshot = rufSnapshot(context->uf);
+
+    for (long long i = tree->offsets[node]; i < tree->offsets[node] + tree->counts[node]; i++)
+    {
+        int life = tree->items[i];
+        rufUnion(context->uf, context->lifeU[life], context->lifeV[life]);
+    }
+
+    if (hi - lo == 1)
+    {
+        long long e = context->queryEvent[lo];
+        const DCEvent *query = &context->events[e];
+        context->answers[e] = rufConnected(context->uf, query->u, query->v);
+    }
+    else
+    {
+        int mid = lo + (hi - lo) / 2;
+        solve(context, 2 * node, lo, mid);
+        solve(context, 2 * node + 1, mid, hi);
+    }
+
+    rufRollback(context->uf, snapshot);
+}
+
+/*
+ * offlineDynamicConnectivity - Answers every connectivity query of a
+ * fully known add / remove / query timeline
+ * @n: vertices are 0 .. n-1
+ * @events: the timeline, in order
+ * @answers: out, one slot per event: 1 / 0 for queries, -1 otherwise
+ *
+ * Removing an edge that is not present is ignored.
+ *
+ * Returns: number of queries answered, or -1 on allocation failure
+ *
+ * Time Complexity: O(count log Q log n), Space: O(count log Q)
+ */
+long long offlineDynamicConnectivity(int n, const DCEvent *events, long long count, int *answers)
+{
+    long long adds = 0, queries = 0;
+    for (long long e = 0; e < count; e++)
+    {
+        answers[e] = -1;
+        if (events[e].type == DC_ADD)
+            adds++;
+        else if (events[e].type == DC_QUERY)
+            queries++;
+    }
+    if (queries == 0)
+        return 0;
+
+    unsigned long long tableSize = 16;
+    while (tableSize < 2 * (unsigned long long)adds)
+        tableSize <<= 1;
+
+    // queryBefore[e] = queries strictly before event e
+    long long *queryBefore = (long long *)malloc((count + 1) * sizeof(long long));
+    long long *queryEvent = (long long *)malloc(queries * sizeof(long long));
+    long long *previousOpen = (long long *)malloc((count > 0 ? count : 1) * sizeof(long long));
+    int *lifeU = (int *)malloc((adds > 0 ? adds : 1) * sizeof(int));
+    int *lifeV = (int *)malloc((adds > 0 ? adds : 1) * sizeof(int));
+    int *lifeFirst = (int *)malloc((adds > 0 ? adds : 1) * sizeof(int));
+    int *lifeLast = (int *)malloc((adds > 0 ? adds : 1) * sizeof(int));
+    OpenEdge *table = (OpenEdge *)malloc(tableSize * sizeof(OpenEdge));
+    RollbackUnionFind *uf = createRollbackUnionFind(n);
+
+    TimeTree tree;
+    tree.leaves = (int)queries;
+    tree.counts = (long long *)calloc(4 * queries, sizeof(long long));
+    tree.offsets = (long long *)malloc((4 * queries + 1) * sizeof(long long));
+    tree.items = NULL;
+
+    if (queryBefore == NULL || queryEvent == NULL || previousOpen == NULL || lifeU == NULL ||
+        lifeV == NULL || lifeFirst == NULL || lifeLast == NULL || table == NULL || uf == NULL ||
+        tree.counts == NULL || tree.offsets == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        queries = -1;
+    }
+    else
+    {
+        memset(table, 0xFF, tableSize * sizeof(OpenEdge));
+        unsigned long long mask = tableSize - 1;
+
+        // Pass 1: number the queries, pair removes with open adds
+        long long q = 0, lives = 0;
+        for (long long e = 0; e < count; e++)
+        {
+            queryBefore[e] = q;
+            const DCEvent *event = &events[e];
+
+            if (event->type == DC_QUERY)
+            {
+                queryEvent[q++] = e;
+            }
+            else if (event->type == DC_ADD)
+            {
+                OpenEdge *slot = lookup(table, mask, edgeKey(event->u, event->v));
+                if (slot->key == ~0ULL)
+                {
+                    slot->key = edgeKey(event->u, event->v);
+                    slot->latest = -1;
+                }
+                previousOpen[e] = slot->latest;
+                slot->latest = e;
+            }
+            else
+            {
+                OpenEdge *slot = lookup(table, mask, edgeKey(event->u, event->v));
+                if (slot->key == ~0ULL || slot->latest == -1)
+                    continue;
+
+                long long added = slot->latest;
+                slot->latest = previousOpen[added];
+                previousOpen[added] = -2;   // closed
+
+                lifeU[lives] = event->u;
+                lifeV[lives] = event->v;
+                lifeFirst[lives] = (int)queryBefore[added];
+                lifeLast[lives] = (int)q;
+                lives++;
+            }
+        }
+        queryBefore[count] = q;
+
+        // Adds never removed live until the end
+        for (long long e = 0; e < count; e++)
+        {
+            if (events[e].type != DC_ADD || previousOpen[e] == -2)
+                continue;
+            lifeU[lives] = events[e].u;
+            lifeV[lives] = events[e].v;
+            lifeFirst[lives] = (int)queryBefore[e];
+            lifeLast[lives] = (int)queries;
+            lives++;
+        }
+
+        // Pass 2: count per node, prefix sum, fill
+        for (long long i = 0; i < lives; i++)
+        {
+            if (lifeFirst[i] < lifeLast[i])
+                cover(&tree, 1, 0, tree.leaves, lifeFirst[i], lifeLast[i], (int)i, 0);
+        }
+
+        tree.offsets[0] = 0;
+        for (long long node = 0; node < 4 * queries; node++)
+        {
+            tree.offsets[node + 1] = tree.offsets[node] + tree.counts[node];
+            tree.counts[node] = 0;
+        }
+
+        tree.items = (int *)malloc((tree.offsets[4 * queries] > 0 ? tree.offsets[4 * queries] : 1) * sizeof(int));
+        if (tree.items == NULL)
+        {
+            printf("Memory allocation failed!\n");
+            queries = -1;
+        }
+        else
+        {
+            for (long long i = 0; i < lives; i++)
+            {
+                if (lifeFirst[i] < lifeLast[i])
+                    cover(&tree, 1, 0, tree.leaves, lifeFirst[i], lifeLast[i], (int)i, 1);
+            }
+
+            SolveContext context = {&tree, uf, lifeU, lifeV, events, queryEvent, answers};
+            solve(&context, 1, 0, tree.leaves);
+        }
+    }
+
+    free(queryBefore);
+    free(queryEvent);
+    free(previousOpen);
+    free(lifeU);
+    free(lifeV);
+    free(lifeFirst);
+    free(lifeLast);
+    free(table);
+    free(tree.counts);
+    free(tree.offsets);
+    free(tree.items);
+    freeRollbackUnionFind(uf);
+    return queries;
+}
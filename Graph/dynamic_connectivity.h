@@ -0,0 +1,41 @@
+#ifndef DYNAMIC_CONNECTIVITY_H
+#define DYNAMIC_CONNECTIVITY_H
+
+/*
+ * ============================================================================
+ * OFFLINE DYNAMIC CONNECTIVITY (segment tree over time)
+ * ============================================================================
+ *
+ * Input: a timeline of "add edge", "remove edge" and "are u, v connected?"
+ * events, all known in advance.
+ *
+ *   1. Pair every remove with the latest open add of the same edge; each
+ *      pair is a lifetime [add, remove) (unmatched adds live to the end).
+ *   2. Lifetimes are cut to query indices and stored in a segment tree
+ *      over the queries: O(log Q) nodes per lifetime.
+ *   3. A DFS over the tree unions a node's edges on the way down and
+ *      rolls them back on the way up (RollbackUnionFind); at a leaf the
+ *      structure holds exactly the edges alive at that query.
+ *
+ * Total: O(m log Q log n) instead of O(Q * m) for rebuilding per query.
+ * Parallel edges are counted: an edge stays until every copy is removed.
+ * ============================================================================
+ */
+
+typedef enum DCEventType
+{
+    DC_ADD,
+    DC_REMOVE,
+    DC_QUERY
+} DCEventType;
+
+typedef struct DCEvent
+{
+    DCEventType type;
+    int u;
+    int v;
+} DCEvent;
+
+long long offlineDynamicConnectivity(int n, const DCEvent *events, long long count, int *answers);
+
+#endif
@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "union_find.h"
+#include "rollback_union_find.h"
+#include "dynamic_connectivity.h"
+
+/*
+ * Test driver / benchmark for rollback_union_find.c and dynamic_connectivity.c
+ *
+ *   1. snapshot / rollback on a small RollbackUnionFind
+ *   2. a small random timeline checked against rebuilding a UnionFind from
+ *      the live edges at every query
+ *   3. a large timeline (default 1M events) timed on its own
+ *
+ * Build: gcc -O2 union_find.c rollback_union_find.c dynamic_connectivity.c dynamic_connectivity_bench.c -o dyncon
+ * Usage: ./dyncon [vertices] [events]
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned long long nextRandom(unsigned long long *state)
+{
+    // xorshift64
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/*
+ * generateTimeline - Random events: 40% add, 30% remove of a live edge,
+ * 30% query. live[] tracks the current edge multiset.
+ */
+static DCEvent *generateTimeline(int n, long long count, unsigned long long seed)
+{
+    DCEvent *events = (DCEvent *)malloc(count * sizeof(DCEvent));
+    DCEvent *live = (DCEvent *)malloc(count * sizeof(DCEvent));
+    long long liveCount = 0;
+    unsigned long long state = seed | 1;
+
+    for (long long e = 0; e < count; e++)
+    {
+        int roll = (int)(nextRandom(&state) % 10);
+        DCEvent *event = &events[e];
+
+        if (roll < 3 && liveCount > 0)
+        {
+            long long pick = (long long)(nextRandom(&state) % liveCount);
+            *event = live[pick];
+            event->type = DC_REMOVE;
+            live[pick] = live[--liveCount];
+        }
+        else
+        {
+            event->type = roll < 7 ? DC_ADD : DC_QUERY;
+            event->u = (int)(nextRandom(&state) % n);
+            event->v = (int)(nextRandom(&state) % n);
+            if (event->type == DC_ADD)
+                live[liveCount++] = *event;
+        }
+    }
+
+    free(live);
+    return events;
+}
+
+/*
+ * bruteForce - Rebuilds a UnionFind from the live edges at every query
+ */
+static void bruteForce(int n, const DCEvent *events, long long count, int *answers)
+{
+    DCEvent *live = (DCEvent *)malloc(count * sizeof(DCEvent));
+    long long liveCount = 0;
+    UnionFind *uf = createUnionFind(n);
+
+    for (long long e = 0; e < count; e++)
+    {
+        const DCEvent *event = &events[e];
+        answers[e] = -1;
+
+        if (event->type == DC_ADD)
+        {
+            live[liveCount++] = *event;
+        }
+        else if (event->type == DC_REMOVE)
+        {
+            for (long long i = liveCount - 1; i >= 0; i--)
+            {
+                if ((live[i].u == event->u && live[i].v == event->v) ||
+                    (live[i].u == event->v && live[i].v == event->u))
+                {
+                    live[i] = live[--liveCount];
+                    break;
+                }
+            }
+        }
+        else
+        {
+            ufReset(uf);
+            for (long long i = 0; i < liveCount; i++)
+                ufUnion(uf, live[i].u, live[i].v);
+            answers[e] = ufConnected(uf, event->u, event->v);
+        }
+    }
+
+    freeUnionFind(uf);
+    free(live);
+}
+
+int main(int argc, char **argv)
+{
+    int n = (argc > 1) ? atoi(argv[1]) : 100000;
+    long long count = (argc > 2) ? atoll(argv[2]) : 1000000;
+    int allOk = 1;
+
+    // 1. Snapshot / rollback
+    RollbackUnionFind *uf = createRollbackUnionFind(6);
+    rufUnion(uf, 0, 1);
+    int snapshot = rufSnapshot(uf);
+    rufUnion(uf, 1, 2);
+    rufUnion(uf, 3, 4);
+    printf("After 0-1, 1-2, 3-4: components %d, 0~2 %d\n", rufComponentCount(uf), rufConnected(uf, 0, 2));
+    rufRollback(uf, snapshot);
+    printf("Rolled back to 0-1:  components %d, 0~2 %d, 0~1 %d\n", rufComponentCount(uf),
+           rufConnected(uf, 0, 2), rufConnected(uf, 0, 1));
+    allOk = allOk && rufComponentCount(uf) == 5 && !rufConnected(uf, 0, 2) && rufConnected(uf, 0, 1);
+    freeRollbackUnionFind(uf);
+
+    // 2. Small timelines against brute force
+    for (int round = 0; round < 20; round++)
+    {
+        int smallN = 5 + round * 3;
+        long long smallCount = 3000;
+        DCEvent *events = generateTimeline(smallN, smallCount, 1000 + round);
+        int *expected = (int *)malloc(smallCount * sizeof(int));
+        int *answers = (int *)malloc(smallCount * sizeof(int));
+
+        bruteForce(smallN, events, smallCount, expected);
+        offlineDynamicConnectivity(smallN, events, smallCount, answers);
+        for (long long e = 0; e < smallCount; e++)
+            allOk = allOk && answers[e] == expected[e];
+
+        free(events);
+        free(expected);
+        free(answers);
+    }
+    printf("Random timelines vs brute force: %s\n", allOk ? "OK" : "MISMATCH");
+
+    // 3. Large timeline
+    DCEvent *events = generateTimeline(n, count, 42);
+    int *answers = (int *)malloc(count * sizeof(int));
+    double start = nowSeconds();
+    long long queries = offlineDynamicConnectivity(n, events, count, answers);
+    double seconds = nowSeconds() - start;
+
+    long long connected = 0;
+    for (long long e = 0; e < count; e++)
+        connected += (answers[e] == 1);
+    printf("%lld events on %d vertices: %lld queries (%lld connected) in %.3f s\n",
+           count, n, queries, connected, seconds);
+
+    free(events);
+    free(answers);
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,25 @@
+#ifndef EDGE_H
+#define EDGE_H
+
+/*
+ * Edge list entry shared by the graph modules: an (undirected or
+ * directed, depending on the caller) pair of vertex ids.
+ */
+typedef struct Edge
+{
+    int u;
+    int v;
+} Edge;
+
+/*
+ * Weighted edge: same layout as Edge plus an integer weight, so a
+ * weighted edge list is simply an int array with stride 3.
+ */
+typedef struct WeightedEdge
+{
+    int u;
+    int v;
+    int w;
+} WeightedEdge;
+
+#endif
@@ -0,0 +1,147 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "graph_gen.h"
+
+static unsigned long long nextRandom(unsigned long long *state)
+{
+    // xorshift64*
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 2685821657736338717ULL;
+}
+
+/*
+ * generateUniformEdges - m edges with both endpoints uniform in [0, n)
+ */
+Edge *generateUniformEdges(int n, long long m, unsigned long long seed)
+{
+    Edge *edges = (Edge *)malloc((m > 0 ? m : 1) * sizeof(Edge));
+    if (edges == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    unsigned long long state = seed | 1;
+    for (long long e = 0; e < m; e++)
+    {
+        unsigned long long r = nextRandom(&state);
+        edges[e].u = (int)((r & 0xFFFFFFFFULL) % n);
+        edges[e].v = (int)((r >> 32) % n);
+    }
+
+    return edges;
+}
+
+/*
+ * generateRMATEdges - m edges over 2^scale vertices
+ *
+ * Each edge picks one quadrant of the adjacency matrix per bit of the
+ * vertex id: top-left with probability a, top-right b, bottom-left c,
+ * bottom-right d = 1 - a - b - c. Vertex ids are then scrambled so
+ * high-degree vertices are not all at small ids.
+ */
+Edge *generateRMATEdges(int scale, long long m, unsigned long long seed)
+{
+    Edge *edges = (Edge *)malloc((m > 0 ? m : 1) * sizeof(Edge));
+    if (edges == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    const unsigned int a = 57, b = 19, c = 19;     // percent
+    unsigned int mask = (scale >= 31) ? 0x7FFFFFFFu : ((1u << scale) - 1);
+    unsigned long long state = seed | 1;
+
+    for (long long e = 0; e < m; e++)
+    {
+        unsigned int u = 0, v = 0;
+        for (int bit = 0; bit < scale; bit++)
+        {
+            unsigned int r = (unsigned int)(nextRandom(&state) % 100);
+            if (r < a)
+                continue;                       // top-left
+            if (r < a + b)
+                v |= 1u << bit;                 // top-right
+            else if (r < a + b + c)
+                u |= 1u << bit;                 // bottom-left
+            else
+            {
+                u |= 1u << bit;                 // bottom-right
+                v |= 1u << bit;
+            }
+        }
+
+        // Scramble ids with an odd multiplier (a bijection mod 2^scale)
+        edges[e].u = (int)((u * 2654435761u + 12345u) & mask);
+        edges[e].v = (int)((v * 2654435761u + 12345u) & mask);
+    }
+
+    return edges;
+}
+
+/*
+ * generateGridEdges - Right and down edges of a rows x cols grid
+ * @m: receives the number of edges, rows*(cols-1) + (rows-1)*cols
+ *
+ * Vertex (r, c) has id r * cols + c.
+ */
+Edge *generateGridEdges(int rows, int cols, long long *m)
+{
+    *m = (long long)rows * (cols - 1) + (long long)(rows - 1) * cols;
+    Edge *edges = (Edge *)malloc((*m > 0 ? *m : 1) * sizeof(Edge));
+    if (edges == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    long long e = 0;
+    for (int r = 0; r < rows; r++)
+    {
+        for (int c = 0; c < cols; c++)
+        {
+            int id = r * cols + c;
+            if (c + 1 < cols)
+            {
+                edges[e].u = id;
+                edges[e].v = id + 1;
+                e++;
+            }
+            if (r + 1 < rows)
+            {
+                edges[e].u = id;
+                edges[e].v = id + cols;
+                e++;
+            }
+        }
+    }
+
+    return edges;
+}
+
+/*
+ * addRandomWeights - Copies an edge list and gives every edge a weight
+ * uniform in [1, maxWeight]
+ */
+WeightedEdge *addRandomWeights(const Edge *edges, long long m, int maxWeight, unsigned long long seed)
+{
+    WeightedEdge *weighted = (WeightedEdge *)malloc((m > 0 ? m : 1) * sizeof(WeightedEdge));
+    if (weighted == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    unsigned long long state = seed | 1;
+    for (long long e = 0; e < m; e++)
+    {
+        weighted[e].u = edges[e].u;
+        weighted[e].v = edges[e].v;
+        weighted[e].w = 1 + (int)(nextRandom(&state) % maxWeight);
+    }
+
+    return weighted;
+}
@@ -0,0 +1,23 @@
+#ifndef GRAPH_GEN_H
+#define GRAPH_GEN_H
+
+#include "edge.h"
+
+/*
+ * Synthetic edge lists for the graph benchmarks. All generators are
+ * deterministic for a given seed and return malloc'd arrays (NULL on
+ * allocation failure) that the caller frees.
+ *
+ *   uniform - both endpoints uniform in [0, n)        (Erdos-Renyi like)
+ *   R-MAT   - recursive quadrant choice (a=.57, b=c=.19), n = 2^scale;
+ *             skewed power-law degrees like social / web graphs
+ *   grid    - rows x cols lattice, 4-neighborhood; large diameter and
+ *             low degree like a road network
+ */
+
+Edge *generateUniformEdges(int n, long long m, unsigned long long seed);
+Edge *generateRMATEdges(int scale, long long m, unsigned long long seed);
+Edge *generateGridEdges(int rows, int cols, long long *m);
+WeightedEdge *addRandomWeights(const Edge *edges, long long m, int maxWeight, unsigned long long seed);
+
+#endif
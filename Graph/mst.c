@@ -0,0 +1,431 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mst.h"
+#include "union_find.h"
+#include "concurrent_union_find.h"
+#include "parallel.h"
+
+#define NO_EDGE 0xFFFFFFFFFFFFFFFFULL
+
+/*
+ * edgeKey - Packs (weight, index) into one 64-bit key ordered like the pair
+ *
+ * The weight's sign bit is flipped so negative weights sort first; the
+ * index sits in the low 32 bits and breaks ties.
+ */
+static unsigned long long edgeKey(int weight, long long index)
+{
+    unsigned long long w = (unsigned int)weight ^ 0x80000000u;
+    return (w << 32) | (unsigned long long)index;
+}
+
+static MSTResult *createMSTResult(int n)
+{
+    MSTResult *result = (MSTResult *)calloc(1, sizeof(MSTResult));
+    if (result == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    result->edges = (long long *)malloc((n > 0 ? n : 1) * sizeof(long long));
+    if (result->edges == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(result);
+        return NULL;
+    }
+
+    return result;
+}
+
+void freeMSTResult(MSTResult *result)
+{
+    if (result == NULL)
+        return;
+    free(result->edges);
+    free(result);
+}
+
+/*
+ * kruskalMST - Minimum spanning forest by Kruskal's algorithm
+ * @edges: m undirected weighted edges over vertices 0 .. n-1 (m < 2^32)
+ *
+ * Returns: the chosen edges, or NULL on failure
+ *
+ * Time Complexity: O(m) radix sort + O(m α(n)) union-find scan,
+ * which stops as soon as n - 1 edges are chosen
+ */
+MSTResult *kruskalMST(const WeightedEdge *edges, long long m, int n, int threads)
+{
+    MSTResult *result = createMSTResult(n);
+    unsigned long long *keys = (unsigned long long *)malloc((m > 0 ? m : 1) * sizeof(unsigned long long));
+    UnionFind *uf = createUnionFind(n);
+    if (result == NULL || keys == NULL || uf == NULL)
+    {
+        freeMSTResult(result);
+        free(keys);
+        freeUnionFind(uf);
+        return NULL;
+    }
+
+    for (long long e = 0; e < m; e++)
+        keys[e] = edgeKey(edges[e].w, e);
+
+    // Index bits are already in input order; only the weight needs sorting
+    if (parallelRadixSort(keys, m, 32, 64, threads) != 0)
+    {
+        freeMSTResult(result);
+        free(keys);
+        freeUnionFind(uf);
+        return NULL;
+    }
+
+    for (long long i = 0; i < m && result->edgeCount < n - 1; i++)
+    {
+        long long e = (long long)(keys[i] & 0xFFFFFFFFULL);
+        if (ufUnion(uf, edges[e].u, edges[e].v))
+        {
+            result->edges[result->edgeCount++] = e;
+            result->totalWeight += edges[e].w;
+        }
+    }
+    result->components = ufComponentCount(uf);
+
+    free(keys);
+    freeUnionFind(uf);
+    return result;
+}
+
+/*
+ * ContractedEdge - An edge still crossing components, with its endpoints
+ * renamed to the component ids of the current round
+ */
+typedef struct ContractedEdge
+{
+    int u;
+    int v;
+    int w;
+    unsigned int e;                 // index into the input edge array
+} ContractedEdge;
+
+typedef struct BoruvkaContext
+{
+    ConcurrentUnionFind *uf;        // over the n components of this round
+    int n;
+    unsigned long long *best;       // cheapest edge key per component
+    int *label;                     // component id in the next round, or -1
+    ContractedEdge *active;         // edges still crossing components
+    long long activeCount;
+    ContractedEdge *nextActive;
+    long long *threadCount;         // per-thread kept / chosen counts
+    long long *threadFinished;      // per-thread components with no edge left
+    long long *threadWeight;
+    MSTResult *result;
+    long long nextChosen;           // shared slot counter into result->edges
+} BoruvkaContext;
+
+static void atomicMin(unsigned long long *slot, unsigned long long key)
+{
+    unsigned long long current = __atomic_load_n(slot, __ATOMIC_RELAXED);
+    while (key < current &&
+           !__atomic_compare_exchange_n(slot, &current, key, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+        // current was refreshed by the failed CAS; loop re-checks
+    }
+}
+
+/*
+ * prefixThreadCounts - Turns threadCount into exclusive offsets
+ *
+ * Returns: the total
+ */
+static long long prefixThreadCounts(long long *threadCount, int threads)
+{
+    long long total = 0;
+    for (int t = 0; t < threads; t++)
+    {
+        long long c = threadCount[t];
+        threadCount[t] = total;
+        total += c;
+    }
+    return total;
+}
+
+static void resetBestWorker(void *arg, int thread, int threads)
+{
+    BoruvkaContext *context = (BoruvkaContext *)arg;
+    long long first, last;
+    threadRange(context->n, thread, threads, &first, &last);
+
+    for (long long v = first; v < last; v++)
+        context->best[v] = NO_EDGE;
+}
+
+/*
+ * cheapestWorker - Phase 1: offer every active edge to both endpoints
+ *
+ * Endpoints already are component ids, so no find is needed. The key's
+ * low bits hold the position in active[], which is in input order, so
+ * ties still break by edge index.
+ */
+static void cheapestWorker(void *arg, int thread, int threads)
+{
+    BoruvkaContext *context = (BoruvkaContext *)arg;
+    long long first, last;
+    threadRange(context->activeCount, thread, threads, &first, &last);
+
+    for (long long i = first; i < last; i++)
+    {
+        const ContractedEdge *edge = &context->active[i];
+        unsigned long long key = edgeKey(edge->w, i);
+        atomicMin(&context->best[edge->u], key);
+        atomicMin(&context->best[edge->v], key);
+    }
+}
+
+/*
+ * hookWorker - Phase 2: unite along every component's cheapest edge
+ *
+ * Two components may pick the same edge; only one cufUnion call links
+ * them, so each edge is recorded once.
+ */
+static void hookWorker(void *arg, int thread, int threads)
+{
+    BoruvkaContext *context = (BoruvkaContext *)arg;
+    long long first, last;
+    threadRange(context->n, thread, threads, &first, &last);
+
+    long long chosen = 0;
+    for (long long v = first; v < last; v++)
+    {
+        unsigned long long key = context->best[v];
+        if (key == NO_EDGE)
+            continue;
+
+        const ContractedEdge *edge = &context->active[key & 0xFFFFFFFFULL];
+        if (cufUnion(context->uf, edge->u, edge->v))
+        {
+            long long slot = __atomic_fetch_add(&context->nextChosen, 1, __ATOMIC_RELAXED);
+            context->result->edges[slot] = edge->e;
+            context->threadWeight[thread] += edge->w;
+            chosen++;
+        }
+    }
+    context->threadCount[thread] = chosen;
+}
+
+/*
+ * labelCountWorker / labelRootWorker / labelMemberWorker - Phase 3:
+ * number the merged components 0 .. n'-1 for the next round
+ *
+ * A component without any edge (best == NO_EDGE) is a finished tree of
+ * the forest: it is counted and dropped instead of numbered.
+ */
+static void labelCountWorker(void *arg, int thread, int threads)
+{
+    BoruvkaContext *context = (BoruvkaContext *)arg;
+    long long first, last;
+    threadRange(context->n, thread, threads, &first, &last);
+
+    long long roots = 0, finished = 0;
+    for (long long v = first; v < last; v++)
+    {
+        if (cufFind(context->uf, (int)v) != v)
+            continue;
+        if (context->best[v] == NO_EDGE)
+            finished++;
+        else
+            roots++;
+    }
+    context->threadCount[thread] = roots;
+    context->threadFinished[thread] += finished;
+}
+
+static void labelRootWorker(void *arg, int thread, int threads)
+{
+    BoruvkaContext *context = (BoruvkaContext *)arg;
+    long long first, last;
+    threadRange(context->n, thread, threads, &first, &last);
+
+    int next = (int)context->threadCount[thread];
+    for (long long v = first; v < last; v++)
+    {
+        int isRoot = cufFind(context->uf, (int)v) == v && context->best[v] != NO_EDGE;
+        context->label[v] = isRoot ? next++ : -1;
+    }
+}
+
+static void labelMemberWorker(void *arg, int thread, int threads)
+{
+    BoruvkaContext *context = (BoruvkaContext *)arg;
+    long long first, last;
+    threadRange(context->n, thread, threads, &first, &last);
+
+    // Roots were all labelled by the previous pass; only members are written
+    for (long long v = first; v < last; v++)
+    {
+        int root = cufFind(context->uf, (int)v);
+        if (root != v)
+            context->label[v] = context->label[root];
+    }
+}
+
+/*
+ * filterCountWorker / filterCopyWorker - Phase 4: drop edges that now lie
+ * inside one component and rename the rest to the new component ids
+ * (count per thread, prefix sum, copy; the order is kept)
+ */
+static void filterCountWorker(void *arg, int thread, int threads)
+{
+    BoruvkaContext *context = (BoruvkaContext *)arg;
+    long long first, last;
+    threadRange(context->activeCount, thread, threads, &first, &last);
+
+    long long kept = 0;
+    for (long long i = first; i < last; i++)
+    {
+        const ContractedEdge *edge = &context->active[i];
+        if (context->label[edge->u] != context->label[edge->v])
+            kept++;
+    }
+    context->threadCount[thread] = kept;
+}
+
+static void filterCopyWorker(void *arg, int thread, int threads)
+{
+    BoruvkaContext *context = (BoruvkaContext *)arg;
+    long long first, last;
+    threadRange(context->activeCount, thread, threads, &first, &last);
+
+    long long out = context->threadCount[thread];
+    for (long long i = first; i < last; i++)
+    {
+        ContractedEdge edge = context->active[i];
+        int lu = context->label[edge.u];
+        int lv = context->label[edge.v];
+        if (lu == lv)
+            continue;
+        edge.u = lu;
+        edge.v = lv;
+        context->nextActive[out++] = edge;
+    }
+}
+
+/*
+ * boruvkaMST - Minimum spanning forest by parallel Boruvka
+ * @edges: m undirected weighted edges over vertices 0 .. n-1 (m < 2^32)
+ *
+ * Every round contracts the graph: components become the vertices of the
+ * next round and only edges between different components survive, so
+ * both the vertex and the edge count shrink from round to round.
+ *
+ * Returns: the chosen edges, or NULL on failure
+ *
+ * Time Complexity: O(m log n) work in the worst case, O(log n) rounds;
+ * the contracted graph usually shrinks fast, so later rounds are cheap
+ */
+MSTResult *boruvkaMST(const WeightedEdge *edges, long long m, int n, int threads)
+{
+    if (threads < 1)
+        threads = 1;
+
+    BoruvkaContext context;
+    context.n = n;
+    context.uf = NULL;
+    context.best = (unsigned long long *)malloc((n > 0 ? n : 1) * sizeof(unsigned long long));
+    context.label = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    context.active = (ContractedEdge *)malloc((m > 0 ? m : 1) * sizeof(ContractedEdge));
+    context.nextActive = (ContractedEdge *)malloc((m > 0 ? m : 1) * sizeof(ContractedEdge));
+    context.threadCount = (long long *)calloc(threads, sizeof(long long));
+    context.threadFinished = (long long *)calloc(threads, sizeof(long long));
+    context.threadWeight = (long long *)calloc(threads, sizeof(long long));
+    context.result = createMSTResult(n);
+    context.nextChosen = 0;
+
+    if (context.best == NULL || context.label == NULL || context.active == NULL ||
+        context.nextActive == NULL || context.threadCount == NULL ||
+        context.threadFinished == NULL || context.threadWeight == NULL || context.result == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        freeMSTResult(context.result);
+        context.result = NULL;
+    }
+    else
+    {
+        // Self loops never cross two components; drop them up front
+        long long count = 0;
+        for (long long e = 0; e < m; e++)
+        {
+            if (edges[e].u == edges[e].v)
+                continue;
+            context.active[count].u = edges[e].u;
+            context.active[count].v = edges[e].v;
+            context.active[count].w = edges[e].w;
+            context.active[count].e = (unsigned int)e;
+            count++;
+        }
+        context.activeCount = count;
+
+        for (;;)
+        {
+            context.uf = createConcurrentUnionFind(context.n);
+            if (context.uf == NULL)
+            {
+                freeMSTResult(context.result);
+                context.result = NULL;
+                break;
+            }
+
+            parallelRun(threads, resetBestWorker, &context);
+            parallelRun(threads, cheapestWorker, &context);
+
+            long long before = context.nextChosen;
+            parallelRun(threads, hookWorker, &context);
+            if (context.nextChosen == before)
+                break;
+            context.result->rounds++;
+
+            parallelRun(threads, labelCountWorker, &context);
+            int components = (int)prefixThreadCounts(context.threadCount, threads);
+            parallelRun(threads, labelRootWorker, &context);
+            parallelRun(threads, labelMemberWorker, &context);
+
+            parallelRun(threads, filterCountWorker, &context);
+            long long kept = prefixThreadCounts(context.threadCount, threads);
+            parallelRun(threads, filterCopyWorker, &context);
+
+            ContractedEdge *temp = context.active;
+            context.active = context.nextActive;
+            context.nextActive = temp;
+            context.activeCount = kept;
+
+            freeConcurrentUnionFind(context.uf);
+            context.uf = NULL;
+            context.n = components;
+        }
+
+        if (context.result != NULL)
+        {
+            // The round that linked nothing left only edge-less components
+            long long finished = context.n;
+            for (int t = 0; t < threads; t++)
+            {
+                context.result->totalWeight += context.threadWeight[t];
+                finished += context.threadFinished[t];
+            }
+            context.result->edgeCount = context.nextChosen;
+            context.result->components = (int)finished;
+        }
+    }
+
+    freeConcurrentUnionFind(context.uf);
+    free(context.best);
+    free(context.label);
+    free(context.active);
+    free(context.nextActive);
+    free(context.threadCount);
+    free(context.threadFinished);
+    free(context.threadWeight);
+    return context.result;
+}
@@ -0,0 +1,44 @@
+#ifndef MST_H
+#define MST_H
+
+#include "edge.h"
+
+/*
+ * ============================================================================
+ * MINIMUM SPANNING FOREST
+ * ============================================================================
+ *
+ * Kruskal:  sort edges by weight (parallel radix sort), then scan them and
+ *           keep every edge whose endpoints are still in different sets of
+ *           the UnionFind from union_find.c.
+ *
+ * Boruvka:  rounds of
+ *             1. every component picks its cheapest outgoing edge
+ *                (parallel over edges, atomic min per component root)
+ *             2. all picked edges are united in parallel with the lock-free
+ *                ConcurrentUnionFind; a pick that links two sets is kept
+ *             3. the graph is contracted: components are renumbered
+ *                0 .. c-1, edges now inside one component are dropped and
+ *                the rest are relabelled to component ids
+ *           Components at least halve every round -> O(log n) rounds, each
+ *           on a smaller graph than the last.
+ *
+ * Ties are broken by edge index in both, so the order is total, the
+ * forest is unique and both algorithms return exactly the same edges.
+ * ============================================================================
+ */
+
+typedef struct MSTResult
+{
+    long long *edges;           // indices into the input edge array
+    long long edgeCount;
+    long long totalWeight;
+    int components;             // trees in the spanning forest
+    int rounds;                 // Boruvka rounds (0 for Kruskal)
+} MSTResult;
+
+MSTResult *kruskalMST(const WeightedEdge *edges, long long m, int n, int threads);
+MSTResult *boruvkaMST(const WeightedEdge *edges, long long m, int n, int threads);
+void freeMSTResult(MSTResult *result);
+
+#endif
@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mst.h"
+#include "graph_gen.h"
+#include "csr_graph.h"
+#include "parallel.h"
+
+/*
+ * Test driver / benchmark for mst.c
+ *
+ * Runs Kruskal and Boruvka on the same weighted edge list and checks they
+ * pick exactly the same forest (ties are broken by edge index in both).
+ *
+ * Build: gcc -O2 -pthread parallel.c graph_gen.c csr_graph.c union_find.c concurrent_union_find.c mst.c mst_bench.c -o mst
+ * Usage: ./mst [vertices] [edges] [threads]          synthetic uniform + R-MAT
+ *        ./mst --file <edges.txt> [threads]          "u v [w]" lines, random w if missing
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int compareLongs(const void *a, const void *b)
+{
+    long long x = *(const long long *)a;
+    long long y = *(const long long *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * loadEdgeFile - Loads "u v [w]" lines with csrLoadTextEdgeList and
+ * flattens the (unsymmetrized) CSR back into a weighted edge list
+ *
+ * If no line has a weight, the file is read again without weights and
+ * every edge gets a random one.
+ */
+static WeightedEdge *loadEdgeFile(const char *path, int threads, long long *m, int *n)
+{
+    CSRGraph *graph = csrLoadTextEdgeList(path, 1, 0, threads);
+    if (graph != NULL && graph->m == 0)
+    {
+        freeCSRGraph(graph);
+        graph = csrLoadTextEdgeList(path, 0, 0, threads);
+    }
+    if (graph == NULL)
+        return NULL;
+
+    Edge *plain = (Edge *)malloc((graph->m > 0 ? graph->m : 1) * sizeof(Edge));
+    if (plain == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        freeCSRGraph(graph);
+        return NULL;
+    }
+    for (int u = 0; u < graph->n; u++)
+    {
+        for (long long k = graph->offsets[u]; k < graph->offsets[u + 1]; k++)
+        {
+            plain[k].u = u;
+            plain[k].v = graph->neighbors[k];
+        }
+    }
+
+    WeightedEdge *edges = addRandomWeights(plain, graph->m, 1000, 99);
+    free(plain);
+    if (edges != NULL && graph->weights != NULL)
+    {
+        for (long long k = 0; k < graph->m; k++)
+            edges[k].w = graph->weights[k];
+    }
+
+    *m = graph->m;
+    *n = graph->n;
+    freeCSRGraph(graph);
+    return edges;
+}
+
+static int runBoth(const char *name, const WeightedEdge *edges, long long m, int n, int threads)
+{
+    printf("\n%s: %d vertices, %lld edges, %d threads\n", name, n, m, threads);
+
+    double start = nowSeconds();
+    MSTResult *kruskal = kruskalMST(edges, m, n, threads);
+    double kruskalTime = nowSeconds() - start;
+
+    start = nowSeconds();
+    MSTResult *boruvka = boruvkaMST(edges, m, n, threads);
+    double boruvkaTime = nowSeconds() - start;
+
+    if (kruskal == NULL || boruvka == NULL)
+    {
+        freeMSTResult(kruskal);         // accepts NULL
+        freeMSTResult(boruvka);
+        return 0;
+    }
+
+    qsort(kruskal->edges, kruskal->edgeCount, sizeof(long long), compareLongs);
+    qsort(boruvka->edges, boruvka->edgeCount, sizeof(long long), compareLongs);
+    int ok = kruskal->edgeCount == boruvka->edgeCount &&
+             kruskal->totalWeight == boruvka->totalWeight &&
+             kruskal->components == boruvka->components &&
+             memcmp(kruskal->edges, boruvka->edges, kruskal->edgeCount * sizeof(long long)) == 0;
+
+    printf("  kruskal : %7.3f s  weight %lld  edges %lld  trees %d\n",
+           kruskalTime, kruskal->totalWeight, kruskal->edgeCount, kruskal->components);
+    printf("  boruvka : %7.3f s  weight %lld  edges %lld  trees %d  rounds %d\n",
+           boruvkaTime, boruvka->totalWeight, boruvka->edgeCount, boruvka->components, boruvka->rounds);
+    printf("  same forest: %s\n", ok ? "OK" : "MISMATCH");
+
+    freeMSTResult(kruskal);
+    freeMSTResult(boruvka);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    // ---- Small demo ----
+    //   0 --1-- 1
+    //   |  \    |
+    //   4    3  2
+    //   |      \|
+    //   3 --5-- 2
+    WeightedEdge small[] = {{0, 1, 1}, {1, 2, 2}, {0, 2, 3}, {0, 3, 4}, {3, 2, 5}};
+    MSTResult *demo = kruskalMST(small, 5, 4, 1);
+    printf("Kruskal on 4-vertex demo: weight %lld, edges:", demo->totalWeight);   // 7
+    for (long long i = 0; i < demo->edgeCount; i++)
+        printf(" (%d-%d)", small[demo->edges[i]].u, small[demo->edges[i]].v);
+    printf("\n");
+    freeMSTResult(demo);
+
+    int ok = 1;
+    if (argc > 2 && strcmp(argv[1], "--file") == 0)
+    {
+        long long m;
+        int n;
+        int threads = (argc > 3) ? atoi(argv[3]) : defaultThreadCount();
+        WeightedEdge *edges = loadEdgeFile(argv[2], threads, &m, &n);
+        if (edges == NULL)
+            return 1;
+        ok = runBoth(argv[2], edges, m, n, threads);
+        free(edges);
+        return ok ? 0 : 1;
+    }
+
+    int n = (argc > 1) ? atoi(argv[1]) : 1000000;
+    long long m = (argc > 2) ? atoll(argv[2]) : 10000000LL;
+    int threads = (argc > 3) ? atoi(argv[3]) : defaultThreadCount();
+
+    Edge *plain = generateUniformEdges(n, m, 5);
+    WeightedEdge *edges = addRandomWeights(plain, m, 1000000, 6);
+    free(plain);
+    ok = runBoth("uniform random", edges, m, n, threads) && ok;
+    free(edges);
+
+    int scale = 0;
+    while ((1 << (scale + 1)) <= n)
+        scale++;
+    plain = generateRMATEdges(scale, m, 7);
+    edges = addRandomWeights(plain, m, 1000, 8);
+    free(plain);
+    ok = runBoth("R-MAT (skewed degrees, many equal weights)", edges, m, 1 << scale, threads) && ok;
+    free(edges);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "parallel.h"
+
+typedef struct ParallelTask
+{
+    ParallelBody body;
+    void *context;
+    int thread;
+    int threads;
+} ParallelTask;
+
+static void *runTask(void *arg)
+{
+    ParallelTask *task = (ParallelTask *)arg;
+    task->body(task->context, task->thread, task->threads);
+    return NULL;
+}
+
+/*
+ * defaultThreadCount - Number of online CPUs (at least 1)
+ */
+int defaultThreadCount(void)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (int)cpus : 1;
+}
+
+/*
+ * parallelRun - Runs body on `threads` threads and waits for all of them
+ *
+ * The calling thread runs task 0 itself, so threads == 1 costs no
+ * thread creation at all. If a thread cannot be created, the error is
+ * reported and the calling thread also runs every task from that one on,
+ * in order, after task 0; only created threads are joined.
+ */
+void parallelRun(int threads, ParallelBody body, void *context)
+{
+    if (threads < 1)
+        threads = 1;
+
+    pthread_t *handles = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    ParallelTask *tasks = (ParallelTask *)malloc(threads * sizeof(ParallelTask));
+    if (handles == NULL || tasks == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+
+    for (int t = 0; t < threads; t++)
+    {
+        tasks[t].body = body;
+        tasks[t].context = context;
+        tasks[t].thread = t;
+        tasks[t].threads = threads;
+    }
+
+    int started = 1;
+    for (; started < threads; started++)
+    {
+        int error = pthread_create(&handles[started], NULL, runTask, &tasks[started]);
+        if (error != 0)
+        {
+            printf("pthread_create: %s\n", strerror(error));
+            break;
+        }
+    }
+    runTask(&tasks[0]);
+    for (int t = started; t < threads; t++)
+        runTask(&tasks[t]);
+    for (int t = 1; t < started; t++)
+        pthread_join(handles[t], NULL);
+
+    free(handles);
+    free(tasks);
+}
+
+/*
+ * threadRange - Splits [0, total) into `threads` nearly equal slices
+ * and returns slice `thread` as [*first, *last)
+ */
+void threadRange(long long total, int thread, int threads, long long *first, long long *last)
+{
+    *first = total * thread / threads;
+    *last = total * (thread + 1) / threads;
+}
+
+typedef struct RadixContext
+{
+    unsigned long long *source;
+    unsigned long long *destination;
+    long long n;
+    int shift;
+    long long *counts;          // [thread][256]
+} RadixContext;
+
+static void radixCountWorker(void *arg, int thread, int threads)
+{
+    RadixContext *context = (RadixContext *)arg;
+    long long *count = context->counts + thread * 256;
+    long long first, last;
+    threadRange(context->n, thread, threads, &first, &last);
+
+    memset(count, 0, 256 * sizeof(long long));
+    for (long long i = first; i < last; i++)
+        count[(context->source[i] >> context->shift) & 0xFF]++;
+}
+
+static void radixScatterWorker(void *arg, int thread, int threads)
+{
+    RadixContext *context = (RadixContext *)arg;
+    long long *position = context->counts + thread * 256;
+    long long first, last;
+    threadRange(context->n, thread, threads, &first, &last);
+
+    for (long long i = first; i < last; i++)
+    {
+        unsigned long long key = context->source[i];
+        context->destination[position[(key >> context->shift) & 0xFF]++] = key;
+    }
+}
+
+/*
+ * parallelRadixSort - Sorts keys[] ascending by bits [lowBit, highBit)
+ *
+ * LSD radix sort, 8 bits per pass. Each pass: every thread histograms its
+ * slice, a prefix sum over (digit, thread) gives every thread its own
+ * write positions, then every thread scatters its slice. Stable, so bits
+ * below lowBit keep their input order (handy for packing a payload there).
+ *
+ * Returns: 0 on success, -1 if the scratch buffer could not be allocated
+ *
+ * Time Complexity: O(n * (highBit - lowBit) / 8)
+ */
+int parallelRadixSort(unsigned long long *keys, long long n, int lowBit, int highBit, int threads)
+{
+    if (threads < 1)
+        threads = 1;
+
+    unsigned long long *scratch = (unsigned long long *)malloc((n > 0 ? n : 1) * sizeof(unsigned long long));
+    long long *counts = (long long *)malloc(threads * 256 * sizeof(long long));
+    if (scratch == NULL || counts == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(scratch);
+        free(counts);
+        return -1;
+    }
+
+    RadixContext context;
+    context.source = keys;
+    context.destination = scratch;
+    context.n = n;
+    context.counts = counts;
+
+    for (int shift = lowBit; shift < highBit; shift += 8)
+    {
+        context.shift = shift;
+        parallelRun(threads, radixCountWorker, &context);
+
+        // Exclusive prefix sum in (digit, thread) order
+        long long sum = 0;
+        for (int digit = 0; digit < 256; digit++)
+        {
+            for (int t = 0; t < threads; t++)
+            {
+                long long c = counts[t * 256 + digit];
+                counts[t * 256 + digit] = sum;
+                sum += c;
+            }
+        }
+
+        parallelRun(threads, radixScatterWorker, &context);
+
+        unsigned long long *temp = context.source;
+        context.source = context.destination;
+        context.destination = temp;
+    }
+
+    // Odd number of passes: result is in scratch
+    if (context.source != keys)
+        memcpy(keys, context.source, n * sizeof(unsigned long long));
+
+    free(scratch);
+    free(counts);
+    return 0;
+}
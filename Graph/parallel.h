@@ -0,0 +1,19 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+/*
+ * Minimal fork-join helper for the graph kernels.
+ *
+ * parallelRun starts `threads` pthreads, calls body(context, t, threads)
+ * on each and joins them. threadRange gives thread t its contiguous
+ * share of [0, total).
+ */
+
+typedef void (*ParallelBody)(void *context, int thread, int threads);
+
+int defaultThreadCount(void);
+void parallelRun(int threads, ParallelBody body, void *context);
+void threadRange(long long total, int thread, int threads, long long *first, long long *last);
+int parallelRadixSort(unsigned long long *keys, long long n, int lowBit, int highBit, int threads);
+
+#endif
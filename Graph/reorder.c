@@ -0,0 +1,402 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "reorder.h"
+#include "parallel.h"
+
+static int compareKeys(const void *a, const void *b)
+{
+    unsigned long long x = *(const unsigned long long *)a;
+    unsigned long long y = *(const unsigned long long *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * sortByDegree - byDegree[] = all vertices by ascending (degree, id),
+ * or descending degree (ties by id) when descending is set
+ */
+static int sortByDegree(const CSRGraph *graph, int descending, int threads, int *byDegree)
+{
+    int n = graph->n;
+    unsigned long long *keys = (unsigned long long *)malloc((n > 0 ? n : 1) * sizeof(unsigned long long));
+    if (keys == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return -1;
+    }
+
+    long long maxDegree = 0;
+    for (int v = 0; v < n; v++)
+    {
+        if (csrDegree(graph, v) > maxDegree)
+            maxDegree = csrDegree(graph, v);
+    }
+
+    for (int v = 0; v < n; v++)
+    {
+        long long degree = csrDegree(graph, v);
+        if (descending)
+            degree = maxDegree - degree;
+        keys[v] = ((unsigned long long)degree << 32) | (unsigned int)v;
+    }
+
+    int highBit = 32;
+    while (highBit < 64 && (maxDegree >> (highBit - 32)) != 0)
+        highBit++;
+    if (parallelRadixSort(keys, n, 32, highBit, threads) != 0)
+    {
+        free(keys);
+        return -1;
+    }
+
+    for (int i = 0; i < n; i++)
+        byDegree[i] = (int)(keys[i] & 0xFFFFFFFFu);
+    free(keys);
+    return 0;
+}
+
+/*
+ * bfsFrom - Appends the unvisited part of start's component to queue[]
+ * in BFS order, starting at queue[rear]
+ * @byDegree: 1 to append each vertex's new neighbors by ascending degree
+ *            (Cuthill-McKee), 0 for plain neighbor order
+ * @keys: scratch of at least max-degree entries (only with byDegree)
+ *
+ * Returns: the new rear; *lastLevel is where the deepest level starts,
+ * *depth the number of levels
+ */
+static int bfsFrom(const CSRGraph *graph, int start, int byDegree, char *visited, int *queue,
+                   int rear, unsigned long long *keys, int *lastLevel, int *depth)
+{
+    int front = rear;
+    int levelEnd = rear + 1;
+    *lastLevel = rear;
+    *depth = 1;
+
+    visited[start] = 1;
+    queue[rear++] = start;
+
+    while (front < rear)
+    {
+        if (front == levelEnd)
+        {
+            *lastLevel = front;
+            levelEnd = rear;
+            (*depth)++;
+        }
+
+        int u = queue[front++];
+        int first = rear;
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++)
+        {
+            int v = graph->neighbors[e];
+            if (visited[v])
+                continue;
+            visited[v] = 1;
+            queue[rear++] = v;
+        }
+
+        if (byDegree && rear - first > 1)
+        {
+            int added = rear - first;
+            for (int i = 0; i < added; i++)
+            {
+                int v = queue[first + i];
+                keys[i] = ((unsigned long long)csrDegree(graph, v) << 32) | (unsigned int)v;
+            }
+            qsort(keys, added, sizeof(unsigned long long), compareKeys);
+            for (int i = 0; i < added; i++)
+                queue[first + i] = (int)(keys[i] & 0xFFFFFFFFu);
+        }
+    }
+
+    return rear;
+}
+
+/*
+ * pseudoPeripheral - George-Liu heuristic: BFS from v, move to the
+ * lowest-degree vertex of the deepest level, repeat while the depth grows
+ *
+ * Uses queue[rear ..] as scratch and leaves visited[] as it found it.
+ */
+static int pseudoPeripheral(const CSRGraph *graph, int v, char *visited, int *queue, int rear,
+                            unsigned long long *keys)
+{
+    int bestDepth = -1;
+
+    for (int round = 0; round < 4; round++)
+    {
+        int lastLevel, depth;
+        int end = bfsFrom(graph, v, 0, visited, queue, rear, keys, &lastLevel, &depth);
+
+        int candidate = queue[lastLevel];
+        for (int i = lastLevel + 1; i < end; i++)
+        {
+            if (csrDegree(graph, queue[i]) < csrDegree(graph, candidate))
+                candidate = queue[i];
+        }
+
+        for (int i = rear; i < end; i++)
+            visited[queue[i]] = 0;
+
+        if (depth <= bestDepth)
+            break;
+        bestDepth = depth;
+        v = candidate;
+    }
+
+    return v;
+}
+
+/*
+ * reorderPermutation - Computes a locality-improving renumbering
+ *
+ * RCM and BFS orders are sequential (each is one BFS per component);
+ * the degree order is a parallel radix sort.
+ *
+ * Returns: malloc'd newId[old], or NULL on allocation failure
+ *
+ * Time Complexity: O(n + m), plus O(m log d) neighbor sorting for RCM
+ */
+int *reorderPermutation(const CSRGraph *graph, ReorderMethod method, int threads)
+{
+    int n = graph->n;
+    int *order = (int *)malloc((n > 0 ? n : 1) * sizeof(int));          // new -> old
+    int *byDegree = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *newId = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    char *visited = (char *)calloc(n > 0 ? n : 1, 1);
+    long long maxDegree = 1;
+    for (int v = 0; v < n; v++)
+    {
+        if (csrDegree(graph, v) > maxDegree)
+            maxDegree = csrDegree(graph, v);
+    }
+    unsigned long long *keys = (unsigned long long *)malloc(maxDegree * sizeof(unsigned long long));
+
+    int failed = order == NULL || byDegree == NULL || newId == NULL || visited == NULL || keys == NULL;
+    if (failed)
+        printf("Memory allocation failed!\n");
+
+    // sortByDegree reports its own failures
+    if (failed || sortByDegree(graph, method != REORDER_RCM, threads, byDegree) != 0)
+    {
+        free(order);
+        free(byDegree);
+        free(newId);
+        free(visited);
+        free(keys);
+        return NULL;
+    }
+
+    if (method == REORDER_DEGREE)
+    {
+        memcpy(order, byDegree, (size_t)n * sizeof(int));
+    }
+    else
+    {
+        // One BFS per component, started from its lowest-degree vertex
+        // (RCM, refined to a pseudo-peripheral one) or its largest hub (BFS)
+        int rear = 0, lastLevel, depth;
+        for (int i = 0; i < n; i++)
+        {
+            int start = byDegree[i];
+            if (visited[start])
+                continue;
+
+            if (method == REORDER_RCM)
+                start = pseudoPeripheral(graph, start, visited, order, rear, keys);
+            rear = bfsFrom(graph, start, method == REORDER_RCM, visited, order, rear, keys,
+                           &lastLevel, &depth);
+        }
+
+        if (method == REORDER_RCM)
+        {
+            for (int i = 0, j = n - 1; i < j; i++, j--)
+            {
+                int temp = order[i];
+                order[i] = order[j];
+                order[j] = temp;
+            }
+        }
+    }
+
+    for (int i = 0; i < n; i++)
+        newId[order[i]] = i;
+
+    free(order);
+    free(byDegree);
+    free(visited);
+    free(keys);
+    return newId;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Parallel relabeling                                                      */
+/* ------------------------------------------------------------------------ */
+
+typedef struct RelabelContext
+{
+    const CSRGraph *graph;
+    const int *newId;
+    const int *oldId;
+    CSRGraph *relabeled;
+    LocalityMetrics *threadMetrics;
+    long long *threadGaps;
+} RelabelContext;
+
+static void relabelDegreeWorker(void *arg, int thread, int threads)
+{
+    RelabelContext *context = (RelabelContext *)arg;
+    long long first, last;
+    threadRange(context->graph->n, thread, threads, &first, &last);
+
+    for (long long r = first; r < last; r++)
+        context->relabeled->offsets[r + 1] = csrDegree(context->graph, context->oldId[r]);
+}
+
+static void relabelFillWorker(void *arg, int thread, int threads)
+{
+    RelabelContext *context = (RelabelContext *)arg;
+    const CSRGraph *graph = context->graph;
+    CSRGraph *relabeled = context->relabeled;
+    long long first, last;
+    threadRange(graph->n, thread, threads, &first, &last);
+
+    for (long long r = first; r < last; r++)
+    {
+        int u = context->oldId[r];
+        long long slot = relabeled->offsets[r];
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++, slot++)
+        {
+            relabeled->neighbors[slot] = context->newId[graph->neighbors[e]];
+            if (relabeled->weights != NULL)
+                relabeled->weights[slot] = graph->weights[e];
+        }
+    }
+}
+
+/*
+ * relabelCSR - Builds the graph with vertex v renamed to newId[v]
+ *
+ * Each thread owns a contiguous range of new ids and writes only their
+ * lists, so no atomics are needed. Lists are re-sorted afterwards.
+ *
+ * Returns: the relabeled graph (weights kept), or NULL
+ *
+ * Time Complexity: O(n + m) plus neighbor sorting
+ */
+CSRGraph *relabelCSR(const CSRGraph *graph, const int *newId, int threads)
+{
+    int n = graph->n;
+    CSRGraph *relabeled = createCSRGraph(n, graph->m, graph->weights != NULL);
+    int *oldId = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    if (relabeled == NULL || oldId == NULL)
+    {
+        if (oldId == NULL)
+            printf("Memory allocation failed!\n");     // createCSRGraph reports its own
+        freeCSRGraph(relabeled);
+        free(oldId);
+        return NULL;
+    }
+
+    for (int v = 0; v < n; v++)
+        oldId[newId[v]] = v;
+
+    RelabelContext context;
+    context.graph = graph;
+    context.newId = newId;
+    context.oldId = oldId;
+    context.relabeled = relabeled;
+
+    parallelRun(threads, relabelDegreeWorker, &context);
+    for (int r = 0; r < n; r++)
+        relabeled->offsets[r + 1] += relabeled->offsets[r];
+    parallelRun(threads, relabelFillWorker, &context);
+
+    free(oldId);
+    csrSortNeighbors(relabeled, threads);
+    return relabeled;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Locality metrics                                                         */
+/* ------------------------------------------------------------------------ */
+
+static void localityWorker(void *arg, int thread, int threads)
+{
+    RelabelContext *context = (RelabelContext *)arg;
+    const CSRGraph *graph = context->graph;
+    LocalityMetrics *metrics = &context->threadMetrics[thread];
+    long long first, last;
+    threadRange(graph->n, thread, threads, &first, &last);
+
+    double span = 0, gap = 0;
+    long long gaps = 0, bandwidth = 0;
+    for (long long u = first; u < last; u++)
+    {
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++)
+        {
+            long long distance = graph->neighbors[e] - u;
+            if (distance < 0)
+                distance = -distance;
+            span += distance;
+            if (distance > bandwidth)
+                bandwidth = distance;
+            if (e > graph->offsets[u])
+            {
+                gap += graph->neighbors[e] - graph->neighbors[e - 1];
+                gaps++;
+            }
+        }
+    }
+
+    metrics->averageSpan = span;
+    metrics->averageGap = gap;
+    metrics->bandwidth = bandwidth;
+    context->threadGaps[thread] = gaps;
+}
+
+/*
+ * measureLocality - Average arc span, average neighbor gap and bandwidth
+ *
+ * Lower is better for all three: a small span means neighbors' entries
+ * in per-vertex arrays sit close to the vertex's own; a small gap means
+ * one neighbor list touches few cache lines.
+ */
+LocalityMetrics measureLocality(const CSRGraph *graph, int threads)
+{
+    LocalityMetrics total;
+    memset(&total, 0, sizeof(total));
+    if (threads < 1)
+        threads = 1;
+
+    RelabelContext context;
+    context.graph = graph;
+    context.threadMetrics = (LocalityMetrics *)calloc(threads, sizeof(LocalityMetrics));
+    context.threadGaps = (long long *)calloc(threads, sizeof(long long));
+    if (context.threadMetrics == NULL || context.threadGaps == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(context.threadMetrics);
+        free(context.threadGaps);
+        return total;
+    }
+
+    parallelRun(threads, localityWorker, &context);
+
+    long long gaps = 0;
+    for (int t = 0; t < threads; t++)
+    {
+        total.averageSpan += context.threadMetrics[t].averageSpan;
+        total.averageGap += context.threadMetrics[t].averageGap;
+        if (context.threadMetrics[t].bandwidth > total.bandwidth)
+            total.bandwidth = context.threadMetrics[t].bandwidth;
+        gaps += context.threadGaps[t];
+    }
+    total.averageSpan = graph->m > 0 ? total.averageSpan / graph->m : 0;
+    total.averageGap = gaps > 0 ? total.averageGap / gaps : 0;
+
+    free(context.threadMetrics);
+    free(context.threadGaps);
+    return total;
+}
@@ -0,0 +1,211 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "reorder.h"
+#include "graph_gen.h"
+#include "parallel.h"
+#include "bfs.h"
+#include "concurrent_union_find.h"
+#include "sssp.h"
+
+/*
+ * Test driver / benchmark for reorder.c
+ *
+ * Takes a weighted grid and a weighted R-MAT graph, scrambles their ids
+ * with a random permutation (the "effectively random ids" case), then for
+ * every ordering: relabels, prints the locality metrics and times BFS,
+ * connected components and delta-stepping on the result. All three must
+ * give the same answers as on the scrambled graph, up to renaming.
+ *
+ * Build: gcc -O2 -pthread parallel.c graph_gen.c csr_graph.c bfs.c concurrent_union_find.c \
+ *            ../Tree/Heap/heap.c sssp.c reorder.c reorder_bench.c -o reorder
+ * Usage: ./reorder [gridSide] [rmatScale] [threads]
+ */
+
+#define MAX_WEIGHT 100
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned long long nextRandom(unsigned long long *state)
+{
+    // xorshift64
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/*
+ * scramble - Relabels with a uniformly random permutation (Fisher-Yates)
+ */
+static CSRGraph *scramble(CSRGraph *graph, int threads)
+{
+    int *newId = (int *)malloc(graph->n * sizeof(int));
+    unsigned long long state = 77;
+    for (int v = 0; v < graph->n; v++)
+        newId[v] = v;
+    for (int v = graph->n - 1; v > 0; v--)
+    {
+        int j = (int)(nextRandom(&state) % (v + 1));
+        int temp = newId[v];
+        newId[v] = newId[j];
+        newId[j] = temp;
+    }
+
+    CSRGraph *scrambled = relabelCSR(graph, newId, threads);
+    free(newId);
+    freeCSRGraph(graph);
+    return scrambled;
+}
+
+/*
+ * undirectedEdges - Each undirected edge once (u < v), in CSR order
+ */
+static Edge *undirectedEdges(const CSRGraph *graph, long long *count)
+{
+    Edge *edges = (Edge *)malloc((graph->m / 2 + 1) * sizeof(Edge));
+    *count = 0;
+    for (int u = 0; u < graph->n; u++)
+    {
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++)
+        {
+            if (u < graph->neighbors[e])
+            {
+                edges[*count].u = u;
+                edges[*count].v = graph->neighbors[e];
+                (*count)++;
+            }
+        }
+    }
+    return edges;
+}
+
+typedef struct KernelRun
+{
+    long long visited;
+    int components;
+    long long *dist;
+    double bfsSeconds;
+    double ccSeconds;
+    double ssspSeconds;
+} KernelRun;
+
+static void runKernels(const CSRGraph *graph, int source, int threads, KernelRun *run)
+{
+    double start = nowSeconds();
+    BFSResult *result = bfs(graph, source, threads, BFS_AUTO);
+    run->bfsSeconds = nowSeconds() - start;
+    run->visited = result->visited;
+    freeBFSResult(result);
+
+    long long count;
+    Edge *edges = undirectedEdges(graph, &count);
+    int *labels = (int *)malloc(graph->n * sizeof(int));
+    start = nowSeconds();
+    run->components = connectedComponents(edges, count, graph->n, threads, labels);
+    run->ccSeconds = nowSeconds() - start;
+    free(labels);
+    free(edges);
+
+    start = nowSeconds();
+    run->dist = deltaStepping(graph, source, MAX_WEIGHT, threads, NULL);
+    run->ssspSeconds = nowSeconds() - start;
+}
+
+static int runGraph(const char *name, const CSRGraph *graph, int threads)
+{
+    // Highest-degree vertex as the source, so it is in the giant component
+    int source = 0;
+    for (int v = 1; v < graph->n; v++)
+    {
+        if (csrDegree(graph, v) > csrDegree(graph, source))
+            source = v;
+    }
+
+    printf("\n%s: %d vertices, %lld arcs\n", name, graph->n, graph->m);
+    printf("  %-10s %9s %9s %11s %9s %11s %9s %9s %9s  %s\n", "order", "perm ms", "relabel", "avg span",
+           "avg gap", "bandwidth", "BFS ms", "CC ms", "SSSP ms", "check");
+
+    KernelRun base;
+    runKernels(graph, source, threads, &base);
+    LocalityMetrics metrics = measureLocality(graph, threads);
+    printf("  %-10s %9s %9s %11.1f %9.1f %11lld %9.2f %9.2f %9.2f  -\n", "scrambled", "-", "-",
+           metrics.averageSpan, metrics.averageGap, metrics.bandwidth, base.bfsSeconds * 1e3, base.ccSeconds * 1e3,
+           base.ssspSeconds * 1e3);
+
+    const char *names[] = {"RCM", "degree", "BFS"};
+    int allOk = 1;
+
+    for (int method = REORDER_RCM; method <= REORDER_BFS; method++)
+    {
+        double start = nowSeconds();
+        int *newId = reorderPermutation(graph, (ReorderMethod)method, threads);
+        double permSeconds = nowSeconds() - start;
+        start = nowSeconds();
+        CSRGraph *relabeled = relabelCSR(graph, newId, threads);
+        double relabelSeconds = nowSeconds() - start;
+        if (newId == NULL || relabeled == NULL)
+            return 0;
+
+        KernelRun run;
+        runKernels(relabeled, newId[source], threads, &run);
+        metrics = measureLocality(relabeled, threads);
+
+        int ok = run.visited == base.visited && run.components == base.components;
+        for (int v = 0; v < graph->n && ok; v++)
+            ok = run.dist[newId[v]] == base.dist[v];
+        allOk = allOk && ok;
+
+        printf("  %-10s %9.2f %9.2f %11.1f %9.1f %11lld %9.2f %9.2f %9.2f  %s\n", names[method],
+               permSeconds * 1e3, relabelSeconds * 1e3, metrics.averageSpan, metrics.averageGap,
+               metrics.bandwidth,
+               run.bfsSeconds * 1e3, run.ccSeconds * 1e3, run.ssspSeconds * 1e3,
+               ok ? "OK" : "MISMATCH");
+
+        free(run.dist);
+        free(newId);
+        freeCSRGraph(relabeled);
+    }
+
+    free(base.dist);
+    return allOk;
+}
+
+int main(int argc, char **argv)
+{
+    int side = (argc > 1) ? atoi(argv[1]) : 1000;
+    int scale = (argc > 2) ? atoi(argv[2]) : 20;
+    int threads = (argc > 3) ? atoi(argv[3]) : defaultThreadCount();
+    int allOk = 1;
+    char name[64];
+
+    long long m;
+    Edge *edges = generateGridEdges(side, side, &m);
+    WeightedEdge *weighted = addRandomWeights(edges, m, MAX_WEIGHT, 3);
+    CSRGraph *graph = csrFromWeightedEdges(weighted, m, side * side, 1, threads);
+    free(edges);
+    free(weighted);
+    graph = scramble(graph, threads);
+    snprintf(name, sizeof(name), "grid %dx%d, scrambled ids", side, side);
+    allOk = runGraph(name, graph, threads) && allOk;
+    freeCSRGraph(graph);
+
+    m = 16LL << scale;
+    edges = generateRMATEdges(scale, m, 1);
+    weighted = addRandomWeights(edges, m, MAX_WEIGHT, 3);
+    graph = csrFromWeightedEdges(weighted, m, 1 << scale, 1, threads);
+    free(edges);
+    free(weighted);
+    graph = scramble(graph, threads);
+    snprintf(name, sizeof(name), "R-MAT scale %d, scrambled ids", scale);
+    allOk = runGraph(name, graph, threads) && allOk;
+    freeCSRGraph(graph);
+
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "rollback_union_find.h"
+
+/*
+ * createRollbackUnionFind - Creates n singleton sets with an empty history
+ *
+ * The history can never hold more than n - 1 entries (one per successful
+ * union), so it is allocated once up front.
+ *
+ * Returns: pointer to the structure, or NULL if allocation failed
+ *
+ * Time Complexity: O(n)
+ */
+RollbackUnionFind *createRollbackUnionFind(int n)
+{
+    RollbackUnionFind *uf = (RollbackUnionFind *)malloc(sizeof(RollbackUnionFind));
+    if (uf == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    uf->n = n;
+    uf->components = n;
+    uf->historySize = 0;
+    uf->historyCapacity = n > 1 ? n - 1 : 1;
+    uf->parent = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    uf->rank = (int *)calloc(n > 0 ? n : 1, sizeof(int));
+    uf->history = (UndoEntry *)malloc(uf->historyCapacity * sizeof(UndoEntry));
+    if (uf->parent == NULL || uf->rank == NULL || uf->history == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        freeRollbackUnionFind(uf);
+        return NULL;
+    }
+
+    for (int v = 0; v < n; v++)
+        uf->parent[v] = v;
+
+    return uf;
+}
+
+void freeRollbackUnionFind(RollbackUnionFind *uf)
+{
+    if (uf == NULL)
+        return;
+    free(uf->parent);
+    free(uf->rank);
+    free(uf->history);
+    free(uf);
+}
+
+/*
+ * rufFind - Returns the root of v's set without modifying the structure
+ *
+ * Time Complexity: O(log n)
+ */
+int rufFind(const RollbackUnionFind *uf, int v)
+{
+    while (uf->parent[v] != v)
+        v = uf->parent[v];
+    return v;
+}
+
+/*
+ * rufUnion - Merges the sets of u and v by rank and records the change
+ *
+ * Returns: 1 if two sets were merged (one history entry pushed),
+ *          0 if u and v were already connected (nothing pushed)
+ *
+ * Time Complexity: O(log n)
+ */
+int rufUnion(RollbackUnionFind *uf, int u, int v)
+{
+    int rootu = rufFind(uf, u);
+    int rootv = rufFind(uf, v);
+    if (rootu == rootv)
+        return 0;
+
+    // Hang the lower-rank root under the higher one
+    if (uf->rank[rootu] > uf->rank[rootv])
+    {
+        int temp = rootu;
+        rootu = rootv;
+        rootv = temp;
+    }
+
+    UndoEntry *entry = &uf->history[uf->historySize++];
+    entry->child = rootu;
+    entry->rankIncreased = (uf->rank[rootu] == uf->rank[rootv]);
+
+    uf->parent[rootu] = rootv;
+    if (entry->rankIncreased)
+        uf->rank[rootv]++;
+    uf->components--;
+
+    return 1;
+}
+
+int rufConnected(const RollbackUnionFind *uf, int u, int v)
+{
+    return rufFind(uf, u) == rufFind(uf, v);
+}
+
+int rufComponentCount(const RollbackUnionFind *uf)
+{
+    return uf->components;
+}
+
+/*
+ * rufSnapshot - Marks the current state; pass the result to rufRollback
+ */
+int rufSnapshot(const RollbackUnionFind *uf)
+{
+    return uf->historySize;
+}
+
+/*
+ * rufRollback - Undoes every union made after the given snapshot
+ *
+ * Snapshots nest like a stack: rolling back to an older snapshot also
+ * discards every newer one.
+ *
+ * Time Complexity: O(number of unions undone)
+ */
+void rufRollback(RollbackUnionFind *uf, int snapshot)
+{
+    while (uf->historySize > snapshot)
+    {
+        UndoEntry *entry = &uf->history[--uf->historySize];
+        int root = uf->parent[entry->child];
+
+        if (entry->rankIncreased)
+            uf->rank[root]--;
+        uf->parent[entry->child] = entry->child;
+        uf->components++;
+    }
+}
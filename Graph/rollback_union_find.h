@@ -0,0 +1,48 @@
+#ifndef ROLLBACK_UNION_FIND_H
+#define ROLLBACK_UNION_FIND_H
+
+/*
+ * ============================================================================
+ * ROLLBACK UNION-FIND
+ * ============================================================================
+ *
+ * Union-find whose unions can be undone in LIFO order:
+ *
+ *   - union by rank, NO path compression: a union changes exactly one
+ *     parent[] entry (and maybe one rank), so it can be reverted in O(1)
+ *   - every successful union pushes an UndoEntry on a history stack
+ *   - rufSnapshot() returns the stack height, rufRollback() pops back to it
+ *
+ * Without compression find is O(log n) worst case (rank bounds the height).
+ * ============================================================================
+ */
+
+typedef struct UndoEntry
+{
+    int child;          // root that was hung under another root
+    int rankIncreased;  // 1 if the new root's rank went up by one
+} UndoEntry;
+
+typedef struct RollbackUnionFind
+{
+    int *parent;
+    int *rank;          // only meaningful at roots: upper bound on height
+    int n;
+    int components;
+    UndoEntry *history;
+    int historySize;
+    int historyCapacity;
+} RollbackUnionFind;
+
+RollbackUnionFind *createRollbackUnionFind(int n);
+void freeRollbackUnionFind(RollbackUnionFind *uf);
+
+int rufFind(const RollbackUnionFind *uf, int v);
+int rufUnion(RollbackUnionFind *uf, int u, int v);
+int rufConnected(const RollbackUnionFind *uf, int u, int v);
+int rufComponentCount(const RollbackUnionFind *uf);
+
+int rufSnapshot(const RollbackUnionFind *uf);
+void rufRollback(RollbackUnionFind *uf, int snapshot);
+
+#endif
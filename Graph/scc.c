@@ -0,0 +1,325 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "scc.h"
+
+/*
+ * tarjanSCC - Tarjan's algorithm with an explicit DFS stack
+ * @component: out, n entries; component id of every vertex
+ *
+ * index[v] is v's DFS discovery number, low[v] the smallest index
+ * reachable from v's subtree through at most one back / cross arc into
+ * the SCC stack. A visited vertex without a component yet is exactly a
+ * vertex still on the SCC stack, so no separate on-stack flag is needed.
+ * When low[v] == index[v], v is the root of an SCC: pop down to v.
+ *
+ * Returns: number of components, or -1 on allocation failure
+ *
+ * Time Complexity: O(n + m), Space: 5n ints
+ */
+int tarjanSCC(const CSRGraph *graph, int *component)
+{
+    int n = graph->n;
+    int *index = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *low = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *stack = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *callVertex = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    long long *callEdge = (long long *)malloc((n > 0 ? n : 1) * sizeof(long long));
+    if (index == NULL || low == NULL || stack == NULL || callVertex == NULL || callEdge == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(index);
+        free(low);
+        free(stack);
+        free(callVertex);
+        free(callEdge);
+        return -1;
+    }
+
+    const long long *offsets = graph->offsets;
+    const int *neighbors = graph->neighbors;
+    int counter = 0, stackSize = 0, count = 0;
+
+    for (int v = 0; v < n; v++)
+    {
+        index[v] = -1;
+        component[v] = -1;
+    }
+
+    for (int root = 0; root < n; root++)
+    {
+        if (index[root] != -1)
+            continue;
+
+        int depth = 0;
+        index[root] = low[root] = counter++;
+        stack[stackSize++] = root;
+        callVertex[depth] = root;
+        callEdge[depth] = offsets[root];
+        depth++;
+
+        while (depth > 0)
+        {
+            int v = callVertex[depth - 1];
+
+            if (callEdge[depth - 1] < offsets[v + 1])
+            {
+                int w = neighbors[callEdge[depth - 1]++];
+
+                if (index[w] == -1)
+                {
+                    // "Recursive call": descend into w
+                    index[w] = low[w] = counter++;
+                    stack[stackSize++] = w;
+                    callVertex[depth] = w;
+                    callEdge[depth] = offsets[w];
+                    depth++;
+                }
+                else if (component[w] == -1 && index[w] < low[v])
+                {
+                    low[v] = index[w];      // w is on the SCC stack
+                }
+                continue;
+            }
+
+            // All arcs of v done: "return" to the parent
+            depth--;
+            if (low[v] == index[v])
+            {
+                int w;
+                do
+                {
+                    w = stack[--stackSize];
+                    component[w] = count;
+                } while (w != v);
+                count++;
+            }
+            if (depth > 0)
+            {
+                int parent = callVertex[depth - 1];
+                if (low[v] < low[parent])
+                    low[parent] = low[v];
+            }
+        }
+    }
+
+    free(index);
+    free(low);
+    free(stack);
+    free(callVertex);
+    free(callEdge);
+    return count;
+}
+
+/*
+ * finishOrder - Iterative DFS over all vertices; order[] receives the
+ * vertices by increasing finishing time
+ *
+ * Returns: 1 if a back arc was seen (the graph has a cycle), 0 otherwise
+ */
+static int finishOrder(const CSRGraph *graph, int *order, char *state, int *callVertex,
+                       long long *callEdge)
+{
+    const long long *offsets = graph->offsets;
+    const int *neighbors = graph->neighbors;
+    int finished = 0, cyclic = 0;
+
+    memset(state, 0, graph->n);     // 0 = unvisited, 1 = on the DFS path, 2 = finished
+
+    for (int root = 0; root < graph->n; root++)
+    {
+        if (state[root] != 0)
+            continue;
+
+        int depth = 0;
+        state[root] = 1;
+        callVertex[depth] = root;
+        callEdge[depth] = offsets[root];
+        depth++;
+
+        while (depth > 0)
+        {
+            int v = callVertex[depth - 1];
+
+            if (callEdge[depth - 1] < offsets[v + 1])
+            {
+                int w = neighbors[callEdge[depth - 1]++];
+                if (state[w] == 0)
+                {
+                    state[w] = 1;
+                    callVertex[depth] = w;
+                    callEdge[depth] = offsets[w];
+                    depth++;
+                }
+                else if (state[w] == 1)
+                {
+                    cyclic = 1;
+                }
+                continue;
+            }
+
+            depth--;
+            state[v] = 2;
+            order[finished++] = v;
+        }
+    }
+
+    return cyclic;
+}
+
+/*
+ * kosarajuSCC - Kosaraju's two-pass algorithm
+ * @transpose: graph with every arc reversed (csrTranspose)
+ * @component: out, n entries
+ *
+ * Pass 1 records the finishing order on G. Pass 2 walks the transpose
+ * from the latest-finishing unlabeled vertex; everything it reaches is
+ * one SCC. Pass 2 only needs a plain stack, since order does not matter.
+ *
+ * Returns: number of components, or -1 on allocation failure
+ *
+ * Time Complexity: O(n + m) (plus building the transpose)
+ */
+int kosarajuSCC(const CSRGraph *graph, const CSRGraph *transpose, int *component)
+{
+    int n = graph->n;
+    int *order = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *callVertex = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    long long *callEdge = (long long *)malloc((n > 0 ? n : 1) * sizeof(long long));
+    char *state = (char *)malloc(n > 0 ? n : 1);
+    if (order == NULL || callVertex == NULL || callEdge == NULL || state == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(order);
+        free(callVertex);
+        free(callEdge);
+        free(state);
+        return -1;
+    }
+
+    finishOrder(graph, order, state, callVertex, callEdge);
+
+    for (int v = 0; v < n; v++)
+        component[v] = -1;
+
+    int count = 0;
+    int *stack = callVertex;            // reused: pass 2 needs only a stack
+    for (int i = n - 1; i >= 0; i--)
+    {
+        int root = order[i];
+        if (component[root] != -1)
+            continue;
+
+        int stackSize = 0;
+        component[root] = count;
+        stack[stackSize++] = root;
+        while (stackSize > 0)
+        {
+            int v = stack[--stackSize];
+            for (long long e = transpose->offsets[v]; e < transpose->offsets[v + 1]; e++)
+            {
+                int w = transpose->neighbors[e];
+                if (component[w] == -1)
+                {
+                    component[w] = count;
+                    stack[stackSize++] = w;
+                }
+            }
+        }
+        count++;
+    }
+
+    free(order);
+    free(callVertex);
+    free(callEdge);
+    free(state);
+    return count;
+}
+
+/*
+ * topologicalSortKahn - Kahn's algorithm
+ * @order: out, n entries; also used as the FIFO queue
+ *
+ * Vertices enter order[] when their in-degree drops to 0; the read
+ * position chases the write position, so no separate queue is needed.
+ *
+ * Returns: number of vertices placed; less than n means the graph has a
+ *          cycle (the unplaced vertices are on or behind one), -1 on
+ *          allocation failure
+ *
+ * Time Complexity: O(n + m)
+ */
+int topologicalSortKahn(const CSRGraph *graph, int *order)
+{
+    int n = graph->n;
+    int *inDegree = (int *)calloc(n > 0 ? n : 1, sizeof(int));
+    if (inDegree == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return -1;
+    }
+
+    for (long long e = 0; e < graph->m; e++)
+        inDegree[graph->neighbors[e]]++;
+
+    int rear = 0;
+    for (int v = 0; v < n; v++)
+    {
+        if (inDegree[v] == 0)
+            order[rear++] = v;
+    }
+
+    for (int front = 0; front < rear; front++)
+    {
+        int v = order[front];
+        for (long long e = graph->offsets[v]; e < graph->offsets[v + 1]; e++)
+        {
+            int w = graph->neighbors[e];
+            if (--inDegree[w] == 0)
+                order[rear++] = w;
+        }
+    }
+
+    free(inDegree);
+    return rear;
+}
+
+/*
+ * topologicalSortDFS - Reverse postorder of an iterative DFS
+ * @order: out, n entries
+ *
+ * Returns: 0 on success, 1 if the graph has a cycle (order is then not
+ *          a valid topological order), -1 on allocation failure
+ *
+ * Time Complexity: O(n + m)
+ */
+int topologicalSortDFS(const CSRGraph *graph, int *order)
+{
+    int n = graph->n;
+    int *callVertex = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    long long *callEdge = (long long *)malloc((n > 0 ? n : 1) * sizeof(long long));
+    char *state = (char *)malloc(n > 0 ? n : 1);
+    if (callVertex == NULL || callEdge == NULL || state == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(callVertex);
+        free(callEdge);
+        free(state);
+        return -1;
+    }
+
+    int cyclic = finishOrder(graph, order, state, callVertex, callEdge);
+
+    // Latest finish first
+    for (int i = 0, j = n - 1; i < j; i++, j--)
+    {
+        int temp = order[i];
+        order[i] = order[j];
+        order[j] = temp;
+    }
+
+    free(callVertex);
+    free(callEdge);
+    free(state);
+    return cyclic;
+}
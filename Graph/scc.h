@@ -0,0 +1,37 @@
+#ifndef SCC_H
+#define SCC_H
+
+#include "csr_graph.h"
+
+/*
+ * ============================================================================
+ * STRONGLY CONNECTED COMPONENTS AND TOPOLOGICAL SORT (directed CSR graphs)
+ * ============================================================================
+ *
+ * Recursive DFS (like the Tree/BST traversals) needs one C stack frame per
+ * vertex on the current path; a dependency chain of a million vertices
+ * overflows an 8 MB stack. Every DFS here keeps its own call stack in two
+ * flat arrays instead:
+ *
+ *   callVertex[d] - vertex at depth d
+ *   callEdge[d]   - next arc of that vertex to look at
+ *
+ * All working arrays are allocated once per call, n entries each; nothing
+ * is allocated per vertex or per edge.
+ *
+ * tarjanSCC    - one DFS; components come out in reverse topological order
+ * kosarajuSCC  - DFS finishing order on G, then DFS on the transpose;
+ *                components come out in topological order
+ * topologicalSortKahn - repeatedly removes in-degree-0 vertices; the output
+ *                array doubles as the queue
+ * topologicalSortDFS  - reverse DFS postorder, detects back arcs (cycles)
+ * ============================================================================
+ */
+
+int tarjanSCC(const CSRGraph *graph, int *component);
+int kosarajuSCC(const CSRGraph *graph, const CSRGraph *transpose, int *component);
+
+int topologicalSortKahn(const CSRGraph *graph, int *order);
+int topologicalSortDFS(const CSRGraph *graph, int *order);
+
+#endif
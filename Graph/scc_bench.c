@@ -0,0 +1,207 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "scc.h"
+#include "parallel.h"
+
+/*
+ * Test driver / benchmark for scc.c
+ *
+ * The inputs are built around one long chain 0 -> 1 -> ... -> n-1, which
+ * is the worst case for recursive DFS (depth n):
+ *   DAG    - chain + random forward arcs (u < v)
+ *   cyclic - the DAG + a few random backward arcs, closing big cycles
+ *
+ * Checks: every arc goes forward in both topological orders; Tarjan and
+ * Kosaraju give the same partition; Tarjan's numbering is a reverse
+ * topological order of the condensation.
+ *
+ * Build: gcc -O2 -pthread parallel.c csr_graph.c scc.c scc_bench.c -o scc
+ * Usage: ./scc [vertices] [edges] [backArcs] [threads]
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned long long nextRandom(unsigned long long *state)
+{
+    // xorshift64
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static int validTopologicalOrder(const CSRGraph *graph, const int *order, int *position)
+{
+    for (int i = 0; i < graph->n; i++)
+        position[order[i]] = i;
+
+    for (int u = 0; u < graph->n; u++)
+    {
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++)
+        {
+            if (position[u] >= position[graph->neighbors[e]])
+                return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * samePartition - Both labelings split the vertices the same way: the
+ * label map a -> b must be a bijection
+ */
+static int samePartition(const int *a, const int *b, int n, int count, int *map)
+{
+    for (int c = 0; c < count; c++)
+        map[c] = -1;
+
+    for (int v = 0; v < n; v++)
+    {
+        if (map[a[v]] == -1)
+            map[a[v]] = b[v];
+        else if (map[a[v]] != b[v])
+            return 0;
+    }
+    for (int c = 0; c < count; c++)
+        map[c] = -1;
+    for (int v = 0; v < n; v++)
+    {
+        if (map[b[v]] == -1)
+            map[b[v]] = a[v];
+        else if (map[b[v]] != a[v])
+            return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    int n = (argc > 1) ? atoi(argv[1]) : 4000000;
+    long long m = (argc > 2) ? atoll(argv[2]) : 32000000LL;
+    long long backArcs = (argc > 3) ? atoll(argv[3]) : 1000;
+    int threads = (argc > 4) ? atoi(argv[4]) : defaultThreadCount();
+    unsigned long long state = 2024;
+    int allOk = 1;
+
+    // Chain + forward arcs, with room for the backward ones
+    Edge *edges = (Edge *)malloc((n - 1 + m + backArcs) * sizeof(Edge));
+    int *order = (int *)malloc(n * sizeof(int));
+    int *scratch = (int *)malloc(n * sizeof(int));
+    int *tarjan = (int *)malloc(n * sizeof(int));
+    int *kosaraju = (int *)malloc(n * sizeof(int));
+    if (edges == NULL || order == NULL || scratch == NULL || tarjan == NULL || kosaraju == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+
+    long long count = 0;
+    for (int v = 0; v + 1 < n; v++)
+    {
+        edges[count].u = v;
+        edges[count].v = v + 1;
+        count++;
+    }
+    for (long long e = 0; e < m; e++)
+    {
+        int u = (int)(nextRandom(&state) % n);
+        int v = (int)(nextRandom(&state) % n);
+        if (u == v)
+            continue;
+        edges[count].u = u < v ? u : v;
+        edges[count].v = u < v ? v : u;
+        count++;
+    }
+
+    CSRGraph *dag = csrFromEdges(edges, count, n, 0, threads);
+    if (dag == NULL)
+        return 1;
+    printf("DAG: %d vertices, %lld arcs (chain of length %d)\n", n, dag->m, n - 1);
+
+    double start = nowSeconds();
+    int placed = topologicalSortKahn(dag, order);
+    double seconds = nowSeconds() - start;
+    int ok = placed == n && validTopologicalOrder(dag, order, scratch);
+    allOk = allOk && ok;
+    printf("  %-22s %8.3f s  %s\n", "Kahn topological sort", seconds, ok ? "OK" : "INVALID");
+
+    start = nowSeconds();
+    int cyclic = topologicalSortDFS(dag, order);
+    seconds = nowSeconds() - start;
+    ok = cyclic == 0 && validTopologicalOrder(dag, order, scratch);
+    allOk = allOk && ok;
+    printf("  %-22s %8.3f s  %s\n", "DFS topological sort", seconds, ok ? "OK" : "INVALID");
+
+    start = nowSeconds();
+    int components = tarjanSCC(dag, tarjan);
+    seconds = nowSeconds() - start;
+    ok = components == n;
+    allOk = allOk && ok;
+    printf("  %-22s %8.3f s  %d components  %s\n", "Tarjan SCC", seconds, components, ok ? "OK" : "INVALID");
+    freeCSRGraph(dag);
+
+    // Backward arcs turn stretches of the chain into cycles
+    for (long long e = 0; e < backArcs; e++)
+    {
+        int u = (int)(nextRandom(&state) % n);
+        int v = (int)(nextRandom(&state) % n);
+        edges[count].u = u > v ? u : v;
+        edges[count].v = u > v ? v : u;
+        count++;
+    }
+
+    CSRGraph *graph = csrFromEdges(edges, count, n, 0, threads);
+    free(edges);
+    if (graph == NULL)
+        return 1;
+    printf("\ncyclic: %d vertices, %lld arcs (%lld backward)\n", n, graph->m, backArcs);
+
+    start = nowSeconds();
+    placed = topologicalSortKahn(graph, order);
+    cyclic = topologicalSortDFS(graph, order);
+    seconds = nowSeconds() - start;
+    ok = (backArcs == 0) == (placed == n && !cyclic);
+    allOk = allOk && ok;
+    printf("  %-22s %8.3f s  Kahn placed %d, DFS cycle %d  %s\n", "cycle detection", seconds,
+           placed, cyclic, ok ? "OK" : "INVALID");
+
+    start = nowSeconds();
+    int tarjanCount = tarjanSCC(graph, tarjan);
+    seconds = nowSeconds() - start;
+    printf("  %-22s %8.3f s  %d components\n", "Tarjan SCC", seconds, tarjanCount);
+
+    start = nowSeconds();
+    CSRGraph *transpose = csrTranspose(graph, threads);
+    double transposeSeconds = nowSeconds() - start;
+    start = nowSeconds();
+    int kosarajuCount = kosarajuSCC(graph, transpose, kosaraju);
+    seconds = nowSeconds() - start;
+    printf("  %-22s %8.3f s  %d components  (+ %.3f s transpose)\n", "Kosaraju SCC", seconds,
+           kosarajuCount, transposeSeconds);
+
+    ok = tarjanCount == kosarajuCount && samePartition(tarjan, kosaraju, n, tarjanCount, scratch);
+    for (int u = 0; u < n && ok; u++)
+    {
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++)
+        {
+            if (tarjan[u] < tarjan[graph->neighbors[e]])
+                ok = 0;
+        }
+    }
+    allOk = allOk && ok;
+    printf("  %-22s %s\n", "partitions agree", ok ? "OK" : "MISMATCH");
+
+    freeCSRGraph(transpose);
+    freeCSRGraph(graph);
+    free(order);
+    free(scratch);
+    free(tarjan);
+    free(kosaraju);
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,428 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sssp.h"
+#include "parallel.h"
+#include "../Tree/Heap/heap.h"
+
+#define SMALL_FRONTIER 2048
+
+static long long *createDistances(int n)
+{
+    long long *dist = (long long *)malloc((n > 0 ? n : 1) * sizeof(long long));
+    if (dist == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    for (int v = 0; v < n; v++)
+        dist[v] = SSSP_INFINITY;
+    return dist;
+}
+
+/*
+ * validInput - 1 if graph has weights and source is one of its vertices;
+ * otherwise says why and returns 0
+ */
+static int validInput(const CSRGraph *graph, int source)
+{
+    if (graph->weights == NULL)
+    {
+        printf("SSSP needs a weighted graph!\n");
+        return 0;
+    }
+    if (source < 0 || source >= graph->n)
+    {
+        printf("Source %d out of range!\n", source);
+        return 0;
+    }
+    return 1;
+}
+
+/*
+ * dijkstra - Sequential Dijkstra with a lazy-deletion binary heap
+ *
+ * Instead of decrease-key, an improved vertex is pushed again; when an
+ * entry is popped whose key no longer matches dist[v], it is stale and
+ * skipped.
+ *
+ * Returns: malloc'd dist[] (SSSP_INFINITY = unreachable), or NULL on
+ *          failure, for an unweighted graph or a source outside 0 .. n-1
+ *
+ * Time Complexity: O((n + m) log m)
+ */
+long long *dijkstra(const CSRGraph *graph, int source, SSSPStats *stats)
+{
+    if (!validInput(graph, source))
+        return NULL;
+
+    long long *dist = createDistances(graph->n);
+    Heap *heap = createHeap(1024);
+    if (dist == NULL || heap == NULL)
+    {
+        free(dist);
+        freeHeap(heap);
+        return NULL;
+    }
+
+    long long relaxations = 0;
+    dist[source] = 0;
+    heapPush(heap, 0, source);
+
+    HeapItem item;
+    while (heapPop(heap, &item) == 0)
+    {
+        int u = item.value;
+        if (item.key != dist[u])
+            continue;                           // stale entry
+
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++)
+        {
+            int v = graph->neighbors[e];
+            long long candidate = item.key + graph->weights[e];
+            if (candidate < dist[v])
+            {
+                dist[v] = candidate;
+                heapPush(heap, candidate, v);
+                relaxations++;
+            }
+        }
+    }
+
+    if (stats != NULL)
+    {
+        memset(stats, 0, sizeof(SSSPStats));
+        stats->relaxations = relaxations;
+    }
+
+    freeHeap(heap);
+    return dist;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Delta-stepping                                                           */
+/* ------------------------------------------------------------------------ */
+
+typedef struct IntVector
+{
+    int *items;
+    long long size;
+    long long capacity;
+} IntVector;
+
+static void vectorPush(IntVector *vector, int value)
+{
+    if (vector->size == vector->capacity)
+    {
+        long long capacity = vector->capacity ? vector->capacity * 2 : 64;
+        int *grown = (int *)realloc(vector->items, capacity * sizeof(int));
+        if (grown == NULL)
+        {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        vector->items = grown;
+        vector->capacity = capacity;
+    }
+    vector->items[vector->size++] = value;
+}
+
+/*
+ * ThreadBins - One thread's private buckets, so pushes never contend
+ *
+ * Only a cyclic window of buckets exists: bucket b lives in
+ * bins[b & (window - 1)]. Every relaxation lands less than window buckets
+ * above the current one (see deltaStepping), so slots never collide.
+ */
+typedef struct ThreadBins
+{
+    IntVector *bins;            // window slots
+    IntVector settled;          // vertices settled in the current bucket
+    long long relaxations;
+} ThreadBins;
+
+typedef struct DeltaContext
+{
+    const CSRGraph *graph;
+    long long delta;
+    long long *dist;
+    int *frontierEpoch;         // last light iteration that expanded v
+    long long *settledBucket;   // last bucket that settled v
+    int epoch;
+    long long bucket;
+    long long window;           // bucket slots per thread, a power of two
+    int *frontier;
+    long long frontierSize;
+    ThreadBins *threads;
+} DeltaContext;
+
+static IntVector *bucketSlot(DeltaContext *context, ThreadBins *local, long long bucket)
+{
+    return &local->bins[bucket & (context->window - 1)];
+}
+
+/*
+ * relax - Atomic min on dist[v]; on success the vertex goes into the
+ * bucket of its new distance
+ */
+static void relax(DeltaContext *context, ThreadBins *local, int v, long long candidate)
+{
+    long long current = __atomic_load_n(&context->dist[v], __ATOMIC_RELAXED);
+
+    while (candidate < current)
+    {
+        if (__atomic_compare_exchange_n(&context->dist[v], &current, candidate, 1,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+            vectorPush(bucketSlot(context, local, candidate / context->delta), v);
+            local->relaxations++;
+            return;
+        }
+    }
+}
+
+/*
+ * lightWorker - Relaxes the light edges (w < delta) of this thread's slice
+ * of the current bucket and records newly settled vertices
+ */
+static void lightWorker(void *arg, int thread, int threads)
+{
+    DeltaContext *context = (DeltaContext *)arg;
+    ThreadBins *local = &context->threads[thread];
+    const CSRGraph *graph = context->graph;
+    long long first, last;
+    threadRange(context->frontierSize, thread, threads, &first, &last);
+
+    for (long long i = first; i < last; i++)
+    {
+        int u = context->frontier[i];
+        long long du = __atomic_load_n(&context->dist[u], __ATOMIC_RELAXED);
+
+        // Entry moved to another bucket, or duplicate in this iteration
+        if (du / context->delta != context->bucket)
+            continue;
+        if (__atomic_exchange_n(&context->frontierEpoch[u], context->epoch, __ATOMIC_RELAXED) == context->epoch)
+            continue;
+
+        if (__atomic_exchange_n(&context->settledBucket[u], context->bucket, __ATOMIC_RELAXED) != context->bucket)
+            vectorPush(&local->settled, u);
+
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++)
+        {
+            if (graph->weights[e] < context->delta)
+                relax(context, local, graph->neighbors[e], du + graph->weights[e]);
+        }
+    }
+}
+
+/*
+ * heavyWorker - Relaxes the heavy edges (w >= delta) of every vertex this
+ * thread settled in the current bucket; they always land in later buckets
+ */
+static void heavyWorker(void *arg, int thread, int threads)
+{
+    (void)threads;
+    DeltaContext *context = (DeltaContext *)arg;
+    ThreadBins *local = &context->threads[thread];
+    const CSRGraph *graph = context->graph;
+
+    for (long long i = 0; i < local->settled.size; i++)
+    {
+        int u = local->settled.items[i];
+        long long du = context->dist[u];
+
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++)
+        {
+            if (graph->weights[e] >= context->delta)
+                relax(context, local, graph->neighbors[e], du + graph->weights[e]);
+        }
+    }
+    local->settled.size = 0;
+}
+
+/*
+ * gatherBucket - Moves every thread's slot of the current bucket into the
+ * shared frontier
+ *
+ * Returns: number of vertices gathered
+ */
+static long long gatherBucket(DeltaContext *context, int threads, long long *capacity)
+{
+    long long size = 0;
+    for (int t = 0; t < threads; t++)
+        size += bucketSlot(context, &context->threads[t], context->bucket)->size;
+
+    if (size > *capacity)
+    {
+        int *grown = (int *)realloc(context->frontier, size * sizeof(int));
+        if (grown == NULL)
+        {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        context->frontier = grown;
+        *capacity = size;
+    }
+
+    size = 0;
+    for (int t = 0; t < threads; t++)
+    {
+        IntVector *bin = bucketSlot(context, &context->threads[t], context->bucket);
+        if (bin->size > 0)
+            memcpy(context->frontier + size, bin->items, bin->size * sizeof(int));
+        size += bin->size;
+        bin->size = 0;
+    }
+    context->frontierSize = size;
+
+    return size;
+}
+
+/*
+ * nextBucket - Smallest non-empty bucket index above the current one,
+ * or -1 when every bucket is empty
+ */
+static long long nextBucket(DeltaContext *context, int threads)
+{
+    for (long long b = context->bucket + 1; b < context->bucket + context->window; b++)
+    {
+        for (int t = 0; t < threads; t++)
+        {
+            if (bucketSlot(context, &context->threads[t], b)->size > 0)
+                return b;
+        }
+    }
+    return -1;
+}
+
+/*
+ * deltaStepping - Parallel SSSP with buckets of width delta
+ * @graph: CSR graph with non-negative weights
+ * @delta: bucket width (>= 1); try the average edge weight first
+ * @threads: worker threads
+ * @stats: optional counters (may be NULL)
+ *
+ * Small frontiers (and small heavy phases) run on the calling thread only,
+ * so long chains of tiny buckets (road graphs) do not pay thread start-up
+ * on every step.
+ *
+ * A relaxation from bucket b reaches at most dist + maxWeight, i.e. bucket
+ * b + maxWeight / delta + 1, so each thread keeps a cyclic window of the
+ * next power of two above maxWeight / delta + 1 buckets instead of one
+ * bucket per distance range ever reached.
+ *
+ * Returns: malloc'd dist[] (SSSP_INFINITY = unreachable), or NULL on
+ *          failure, for an unweighted graph or a source outside 0 .. n-1
+ */
+long long *deltaStepping(const CSRGraph *graph, int source, long long delta, int threads,
+                         SSSPStats *stats)
+{
+    if (!validInput(graph, source))
+        return NULL;
+    if (threads < 1)
+        threads = 1;
+    if (delta < 1)
+        delta = 1;
+
+    int n = graph->n;
+    DeltaContext context;
+    memset(&context, 0, sizeof(context));
+    context.graph = graph;
+    context.delta = delta;
+    context.dist = createDistances(n);
+    context.frontierEpoch = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    context.settledBucket = (long long *)malloc((n > 0 ? n : 1) * sizeof(long long));
+    context.threads = (ThreadBins *)calloc(threads, sizeof(ThreadBins));
+    long long frontierCapacity = 0;
+
+    long long maxWeight = 0;
+    for (long long e = 0; e < graph->m; e++)
+    {
+        if (graph->weights[e] > maxWeight)
+            maxWeight = graph->weights[e];
+    }
+    context.window = 1;
+    while (context.window <= maxWeight / delta + 1)
+        context.window *= 2;
+
+    int failed = context.dist == NULL || context.frontierEpoch == NULL ||
+                 context.settledBucket == NULL || context.threads == NULL;
+    for (int t = 0; t < threads && !failed; t++)
+    {
+        context.threads[t].bins = (IntVector *)calloc(context.window, sizeof(IntVector));
+        failed = context.threads[t].bins == NULL;
+    }
+    if (failed)
+    {
+        printf("Memory allocation failed!\n");
+        for (int t = 0; context.threads != NULL && t < threads; t++)
+            free(context.threads[t].bins);
+        free(context.dist);
+        free(context.frontierEpoch);
+        free(context.settledBucket);
+        free(context.threads);
+        return NULL;
+    }
+
+    for (int v = 0; v < n; v++)
+    {
+        context.frontierEpoch[v] = -1;
+        context.settledBucket[v] = -1;
+    }
+
+    SSSPStats local;
+    memset(&local, 0, sizeof(local));
+
+    context.dist[source] = 0;
+    vectorPush(bucketSlot(&context, &context.threads[0], 0), source);
+    context.bucket = 0;
+
+    while (context.bucket != -1)
+    {
+        local.buckets++;
+
+        // Light phase: repeat until the bucket stops refilling
+        while (gatherBucket(&context, threads, &frontierCapacity) > 0)
+        {
+            int active = context.frontierSize < SMALL_FRONTIER ? 1 : threads;
+            parallelRun(active, lightWorker, &context);
+            context.epoch++;
+            local.lightPhases++;
+        }
+
+        // Heavy phase: once, from everything settled in this bucket
+        long long settled = 0;
+        for (int t = 0; t < threads; t++)
+            settled += context.threads[t].settled.size;
+
+        if (settled < SMALL_FRONTIER)
+        {
+            for (int t = 0; t < threads; t++)
+                heavyWorker(&context, t, threads);
+        }
+        else
+            parallelRun(threads, heavyWorker, &context);
+
+        context.bucket = nextBucket(&context, threads);
+    }
+
+    for (int t = 0; t < threads; t++)
+    {
+        ThreadBins *bins = &context.threads[t];
+        local.relaxations += bins->relaxations;
+        for (long long b = 0; b < context.window; b++)
+            free(bins->bins[b].items);
+        free(bins->bins);
+        free(bins->settled.items);
+    }
+
+    if (stats != NULL)
+        *stats = local;
+
+    free(context.frontier);
+    free(context.frontierEpoch);
+    free(context.settledBucket);
+    free(context.threads);
+    return context.dist;
+}
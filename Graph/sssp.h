@@ -0,0 +1,45 @@
+#ifndef SSSP_H
+#define SSSP_H
+
+#include <limits.h>
+#include "csr_graph.h"
+
+/*
+ * ============================================================================
+ * SINGLE-SOURCE SHORTEST PATHS (non-negative integer weights)
+ * ============================================================================
+ *
+ * Both need graph->weights; an unweighted graph or a source outside
+ * 0 .. n-1 is rejected with NULL.
+ *
+ * dijkstra       - sequential baseline on the binary Heap from Tree/Heap
+ *                  (lazy deletion: stale heap entries are skipped on pop).
+ *
+ * deltaStepping  - Meyer & Sanders. Tentative distances are kept in
+ *                  buckets of width delta: bucket i holds vertices with
+ *                  dist in [i*delta, (i+1)*delta). For the lowest
+ *                  non-empty bucket:
+ *                    light phase: relax edges with w < delta from every
+ *                                 vertex in the bucket, repeat while the
+ *                                 bucket refills (in parallel)
+ *                    heavy phase: relax edges with w >= delta once from
+ *                                 every vertex settled in the bucket
+ *                  delta -> 1 behaves like Dijkstra (little parallelism),
+ *                  delta -> infinity like Bellman-Ford (much wasted work).
+ * ============================================================================
+ */
+
+#define SSSP_INFINITY LLONG_MAX
+
+typedef struct SSSPStats
+{
+    long long buckets;          // non-empty buckets processed
+    long long lightPhases;      // light-edge iterations over all buckets
+    long long relaxations;      // successful distance improvements
+} SSSPStats;
+
+long long *dijkstra(const CSRGraph *graph, int source, SSSPStats *stats);
+long long *deltaStepping(const CSRGraph *graph, int source, long long delta, int threads,
+                         SSSPStats *stats);
+
+#endif
@@ -0,0 +1,136 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sssp.h"
+#include "graph_gen.h"
+#include "parallel.h"
+
+/*
+ * Test driver / benchmark for sssp.c
+ *
+ * Runs Dijkstra and delta-stepping over a sweep of delta values on two
+ * weighted, symmetrized inputs: a grid (road-network like: low degree,
+ * large diameter) and R-MAT (social-network like: skewed degrees, small
+ * diameter). Every delta-stepping result must equal Dijkstra's distances.
+ *
+ * Build: gcc -O2 -pthread parallel.c graph_gen.c csr_graph.c ../Tree/Heap/heap.c sssp.c sssp_bench.c -o sssp
+ * Usage: ./sssp [gridSide] [rmatScale] [threads] [maxWeight] [delta ...]
+ *        (without explicit deltas, a sweep around maxWeight is used)
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int runGraph(const char *name, const CSRGraph *graph, int threads,
+                    const long long *deltas, int deltaCount)
+{
+    SSSPStats stats;
+    int allOk = 1;
+
+    // Highest-degree vertex, so the source sits in the giant component
+    int source = 0;
+    for (int v = 1; v < graph->n; v++)
+    {
+        if (csrDegree(graph, v) > csrDegree(graph, source))
+            source = v;
+    }
+
+    double start = nowSeconds();
+    long long *reference = dijkstra(graph, source, &stats);
+    double dijkstraSeconds = nowSeconds() - start;
+    if (reference == NULL)
+        return 0;
+
+    long long reached = 0, farthest = 0;
+    for (int v = 0; v < graph->n; v++)
+    {
+        if (reference[v] == SSSP_INFINITY)
+            continue;
+        reached++;
+        if (reference[v] > farthest)
+            farthest = reference[v];
+    }
+
+    printf("\n%s: %d vertices, %lld arcs, source %d reached %lld, max distance %lld\n",
+           name, graph->n, graph->m, source, reached, farthest);
+    printf("  %-18s %9.3f ms  relaxations %10lld\n", "dijkstra", dijkstraSeconds * 1e3,
+           stats.relaxations);
+
+    for (int d = 0; d < deltaCount; d++)
+    {
+        start = nowSeconds();
+        long long *dist = deltaStepping(graph, source, deltas[d], threads, &stats);
+        double seconds = nowSeconds() - start;
+        if (dist == NULL)
+            return 0;
+
+        int ok = memcmp(dist, reference, graph->n * sizeof(long long)) == 0;
+        allOk = allOk && ok;
+
+        char label[32];
+        snprintf(label, sizeof(label), "delta %lld", deltas[d]);
+        printf("  %-18s %9.3f ms  relaxations %10lld  buckets %8lld  light phases %8lld  %s\n",
+               label, seconds * 1e3, stats.relaxations, stats.buckets, stats.lightPhases,
+               ok ? "OK" : "MISMATCH");
+        free(dist);
+    }
+
+    free(reference);
+    return allOk;
+}
+
+int main(int argc, char **argv)
+{
+    int side = (argc > 1) ? atoi(argv[1]) : 1000;
+    int scale = (argc > 2) ? atoi(argv[2]) : 18;
+    int threads = (argc > 3) ? atoi(argv[3]) : defaultThreadCount();
+    int maxWeight = (argc > 4) ? atoi(argv[4]) : 1000;
+
+    long long deltas[16];
+    int deltaCount = 0;
+    for (int i = 5; i < argc && deltaCount < 16; i++)
+        deltas[deltaCount++] = atoll(argv[i]);
+    if (deltaCount == 0)
+    {
+        long long sweep[] = {1, maxWeight / 10, maxWeight / 2, maxWeight, 4LL * maxWeight, 64LL * maxWeight};
+        for (int i = 0; i < 6; i++)
+            deltas[deltaCount++] = sweep[i] > 0 ? sweep[i] : 1;
+    }
+
+    printf("threads %d, weights in [1, %d]\n", threads, maxWeight);
+    int allOk = 1;
+
+    long long m;
+    Edge *edges = generateGridEdges(side, side, &m);
+    WeightedEdge *weighted = addRandomWeights(edges, m, maxWeight, 7);
+    CSRGraph *graph = csrFromWeightedEdges(weighted, m, side * side, 1, threads);
+    free(edges);
+    free(weighted);
+    if (graph == NULL)
+        return 1;
+
+    char name[64];
+    snprintf(name, sizeof(name), "grid %dx%d", side, side);
+    allOk = runGraph(name, graph, threads, deltas, deltaCount) && allOk;
+    freeCSRGraph(graph);
+
+    m = 16LL << scale;
+    edges = generateRMATEdges(scale, m, 1);
+    weighted = addRandomWeights(edges, m, maxWeight, 7);
+    graph = csrFromWeightedEdges(weighted, m, 1 << scale, 1, threads);
+    free(edges);
+    free(weighted);
+    if (graph == NULL)
+        return 1;
+
+    snprintf(name, sizeof(name), "R-MAT scale %d", scale);
+    allOk = runGraph(name, graph, threads, deltas, deltaCount) && allOk;
+    freeCSRGraph(graph);
+
+    return allOk ? 0 : 1;
+}
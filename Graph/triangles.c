@@ -0,0 +1,466 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "triangles.h"
+#include "parallel.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define TRIANGLE_BLOCK_VERTICES 256
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Degree ordering and orientation                                          */
+/* ------------------------------------------------------------------------ */
+
+typedef struct OrientContext
+{
+    const CSRGraph *graph;
+    const int *order;           // rank -> original vertex
+    const int *rank;            // original vertex -> rank
+    long long *offsets;         // out-degrees, then offsets (by rank)
+    int *neighbors;
+} OrientContext;
+
+/*
+ * orientCountWorker - Out-degree of every rank: distinct higher-rank
+ * neighbors (input lists are sorted, so duplicates are adjacent)
+ */
+static void orientCountWorker(void *arg, int thread, int threads)
+{
+    OrientContext *context = (OrientContext *)arg;
+    const CSRGraph *graph = context->graph;
+    long long first, last;
+    threadRange(graph->n, thread, threads, &first, &last);
+
+    for (long long r = first; r < last; r++)
+    {
+        int u = context->order[r];
+        long long degree = 0;
+        int previous = -1;
+
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++)
+        {
+            int w = graph->neighbors[e];
+            if (w != previous && context->rank[w] > r)
+                degree++;
+            previous = w;
+        }
+        context->offsets[r + 1] = degree;
+    }
+}
+
+static void orientFillWorker(void *arg, int thread, int threads)
+{
+    OrientContext *context = (OrientContext *)arg;
+    const CSRGraph *graph = context->graph;
+    long long first, last;
+    threadRange(graph->n, thread, threads, &first, &last);
+
+    for (long long r = first; r < last; r++)
+    {
+        int u = context->order[r];
+        long long slot = context->offsets[r];
+        int previous = -1;
+
+        for (long long e = graph->offsets[u]; e < graph->offsets[u + 1]; e++)
+        {
+            int w = graph->neighbors[e];
+            if (w != previous && context->rank[w] > r)
+                context->neighbors[slot++] = context->rank[w];
+            previous = w;
+        }
+    }
+}
+
+/*
+ * orientByDegree - Relabels vertices by ascending (degree, id) and keeps
+ * each undirected edge once, from the lower to the higher rank
+ * @graph: symmetric CSR graph
+ * @order: out, malloc'd rank -> original vertex map (may be NULL)
+ *
+ * The ordering is one parallel radix sort of (degree << 32 | v) keys.
+ *
+ * Returns: oriented graph in rank ids with sorted out-lists, or NULL
+ *
+ * Time Complexity: O(n + m) plus sorting the out-lists
+ */
+CSRGraph *orientByDegree(const CSRGraph *graph, int threads, int **order)
+{
+    int n = graph->n;
+    unsigned long long *keys = (unsigned long long *)malloc((n > 0 ? n : 1) * sizeof(unsigned long long));
+    int *byRank = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    int *rank = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    long long *offsets = (long long *)calloc((size_t)n + 1, sizeof(long long));
+    if (keys == NULL || byRank == NULL || rank == NULL || offsets == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(keys);
+        free(byRank);
+        free(rank);
+        free(offsets);
+        return NULL;
+    }
+
+    long long maxDegree = 0;
+    for (int v = 0; v < n; v++)
+    {
+        long long degree = csrDegree(graph, v);
+        if (degree > maxDegree)
+            maxDegree = degree;
+        keys[v] = ((unsigned long long)degree << 32) | (unsigned int)v;
+    }
+
+    int highBit = 32;
+    while (highBit < 64 && (maxDegree >> (highBit - 32)) != 0)
+        highBit++;
+    if (parallelRadixSort(keys, n, 32, highBit, threads) != 0)
+    {
+        free(keys);
+        free(byRank);
+        free(rank);
+        free(offsets);
+        return NULL;
+    }
+
+    for (int r = 0; r < n; r++)
+    {
+        byRank[r] = (int)(keys[r] & 0xFFFFFFFFu);
+        rank[byRank[r]] = r;
+    }
+    free(keys);
+
+    OrientContext context;
+    context.graph = graph;
+    context.order = byRank;
+    context.rank = rank;
+    context.offsets = offsets;
+    parallelRun(threads, orientCountWorker, &context);
+
+    for (int r = 0; r < n; r++)
+        offsets[r + 1] += offsets[r];
+
+    CSRGraph *oriented = createCSRGraph(n, offsets[n], 0);
+    if (oriented != NULL)
+    {
+        memcpy(oriented->offsets, offsets, ((size_t)n + 1) * sizeof(long long));
+        context.offsets = oriented->offsets;
+        context.neighbors = oriented->neighbors;
+        parallelRun(threads, orientFillWorker, &context);
+        csrSortNeighbors(oriented, threads);
+    }
+
+    free(offsets);
+    free(rank);
+    if (order != NULL && oriented != NULL)
+        *order = byRank;
+    else
+        free(byRank);
+
+    return oriented;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Intersections                                                            */
+/* ------------------------------------------------------------------------ */
+
+/*
+ * intersectScalar - |a ∩ b| for strictly ascending lists; every common
+ * element is also counted in hits[] when hits is not NULL
+ */
+static long long intersectScalar(const int *a, long long na, const int *b, long long nb,
+                                 long long *hits)
+{
+    long long i = 0, j = 0, count = 0;
+
+    while (i < na && j < nb)
+    {
+        if (a[i] < b[j])
+            i++;
+        else if (a[i] > b[j])
+            j++;
+        else
+        {
+            if (hits != NULL)
+                __atomic_fetch_add(&hits[a[i]], 1, __ATOMIC_RELAXED);
+            count++;
+            i++;
+            j++;
+        }
+    }
+    return count;
+}
+
+/*
+ * intersectSIMD - Block merge: 4 elements of a against 4 of b per step
+ *
+ * b's block is rotated three times so all 16 pairs are compared with four
+ * equality tests; the OR of the masks marks which lanes of a matched.
+ * The block with the smaller last element is then consumed (both if equal).
+ * The tails are finished by the scalar merge.
+ */
+static long long intersectSIMD(const int *a, long long na, const int *b, long long nb,
+                               long long *hits)
+{
+#if defined(__SSE2__)
+    long long i = 0, j = 0, count = 0;
+
+    while (i + 4 <= na && j + 4 <= nb)
+    {
+        __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(b + j));
+
+        __m128i match = _mm_cmpeq_epi32(va, vb);
+        match = _mm_or_si128(match, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+        match = _mm_or_si128(match, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+        match = _mm_or_si128(match, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(match));
+        if (mask != 0)
+        {
+            count += __builtin_popcount(mask);
+            if (hits != NULL)
+            {
+                for (int lane = 0; lane < 4; lane++)
+                {
+                    if (mask & (1 << lane))
+                        __atomic_fetch_add(&hits[a[i + lane]], 1, __ATOMIC_RELAXED);
+                }
+            }
+        }
+
+        int lastA = a[i + 3];
+        int lastB = b[j + 3];
+        if (lastA <= lastB)
+            i += 4;
+        if (lastB <= lastA)
+            j += 4;
+    }
+
+    return count + intersectScalar(a + i, na - i, b + j, nb - j, hits);
+#else
+    return intersectScalar(a, na, b, nb, hits);
+#endif
+}
+
+/* ------------------------------------------------------------------------ */
+/* Parallel counting                                                        */
+/* ------------------------------------------------------------------------ */
+
+typedef struct TriangleContext
+{
+    const CSRGraph *oriented;
+    IntersectMode mode;
+    long long *perVertex;       // by rank, NULL if not requested
+    long long nextBlock;        // shared work counter, in vertices
+    long long *threadCounts;
+} TriangleContext;
+
+/*
+ * countWorker - Grabs blocks of vertices until none are left
+ *
+ * For vertex u and out-neighbor v = N+(u)[i], only N+(u)[i+1 ..] can
+ * close a triangle with N+(v) (everything in N+(v) ranks above v).
+ */
+static void countWorker(void *arg, int thread, int threads)
+{
+    (void)threads;
+    TriangleContext *context = (TriangleContext *)arg;
+    const CSRGraph *graph = context->oriented;
+    const long long *offsets = graph->offsets;
+    const int *neighbors = graph->neighbors;
+    long long *perVertex = context->perVertex;
+    unsigned long long *bits = NULL;
+    long long total = 0;
+
+    if (context->mode == INTERSECT_AUTO || context->mode == INTERSECT_BITSET)
+    {
+        bits = (unsigned long long *)calloc(((size_t)graph->n + 63) / 64, sizeof(unsigned long long));
+        if (bits == NULL)
+        {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+    }
+
+    for (;;)
+    {
+        long long first = __atomic_fetch_add(&context->nextBlock, TRIANGLE_BLOCK_VERTICES, __ATOMIC_RELAXED);
+        if (first >= graph->n)
+            break;
+        long long last = first + TRIANGLE_BLOCK_VERTICES;
+        if (last > graph->n)
+            last = graph->n;
+
+        for (long long u = first; u < last; u++)
+        {
+            const int *a = neighbors + offsets[u];
+            long long degree = offsets[u + 1] - offsets[u];
+            long long closedAtU = 0;
+
+            int useBitset = context->mode == INTERSECT_BITSET ||
+                            (context->mode == INTERSECT_AUTO && degree >= TRIANGLE_DENSE_DEGREE);
+            if (useBitset)
+            {
+                for (long long i = 0; i < degree; i++)
+                    bits[a[i] >> 6] |= 1ULL << (a[i] & 63);
+            }
+
+            for (long long i = 0; i < degree; i++)
+            {
+                int v = a[i];
+                const int *b = neighbors + offsets[v];
+                long long nb = offsets[v + 1] - offsets[v];
+                long long closed = 0;
+
+                if (useBitset)
+                {
+                    for (long long j = 0; j < nb; j++)
+                    {
+                        if (bits[b[j] >> 6] & (1ULL << (b[j] & 63)))
+                        {
+                            closed++;
+                            if (perVertex != NULL)
+                                __atomic_fetch_add(&perVertex[b[j]], 1, __ATOMIC_RELAXED);
+                        }
+                    }
+                }
+                else if (context->mode == INTERSECT_SCALAR)
+                    closed = intersectScalar(a + i + 1, degree - i - 1, b, nb, perVertex);
+                else
+                    closed = intersectSIMD(a + i + 1, degree - i - 1, b, nb, perVertex);
+
+                if (perVertex != NULL && closed > 0)
+                    __atomic_fetch_add(&perVertex[v], closed, __ATOMIC_RELAXED);
+                closedAtU += closed;
+            }
+
+            if (useBitset)
+            {
+                for (long long i = 0; i < degree; i++)
+                    bits[a[i] >> 6] = 0;
+            }
+
+            if (perVertex != NULL && closedAtU > 0)
+                __atomic_fetch_add(&perVertex[u], closedAtU, __ATOMIC_RELAXED);
+            total += closedAtU;
+        }
+    }
+
+    context->threadCounts[thread] = total;
+    free(bits);
+}
+
+/*
+ * countTriangles - Counts triangles of a symmetric graph
+ * @threads: worker threads
+ * @mode: intersection kernel, INTERSECT_AUTO unless benchmarking
+ * @perVertex: 1 to also return per-vertex counts and average clustering
+ *
+ * Returns: malloc'd result (free with freeTriangleResult), or NULL
+ *
+ * Time Complexity: O(m * sqrt(m)) worst case, far less on sparse graphs
+ */
+TriangleResult *countTriangles(const CSRGraph *graph, int threads, IntersectMode mode, int perVertex)
+{
+    if (threads < 1)
+        threads = 1;
+
+    TriangleResult *result = (TriangleResult *)calloc(1, sizeof(TriangleResult));
+    if (result == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    double start = nowSeconds();
+    int *order = NULL;
+    CSRGraph *oriented = orientByDegree(graph, threads, &order);
+    if (oriented == NULL)
+    {
+        free(result);
+        return NULL;
+    }
+    result->orientSeconds = nowSeconds() - start;
+
+    int n = graph->n;
+    TriangleContext context;
+    context.oriented = oriented;
+    context.mode = mode;
+    context.nextBlock = 0;
+    context.perVertex = perVertex ? (long long *)calloc(n > 0 ? n : 1, sizeof(long long)) : NULL;
+    context.threadCounts = (long long *)calloc(threads, sizeof(long long));
+    long long *degree = (long long *)calloc(n > 0 ? n : 1, sizeof(long long));
+    if ((perVertex && context.perVertex == NULL) || context.threadCounts == NULL || degree == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(context.perVertex);
+        free(context.threadCounts);
+        free(degree);
+        free(order);
+        freeCSRGraph(oriented);
+        free(result);
+        return NULL;
+    }
+
+    start = nowSeconds();
+    parallelRun(threads, countWorker, &context);
+    result->countSeconds = nowSeconds() - start;
+
+    for (int t = 0; t < threads; t++)
+        result->triangles += context.threadCounts[t];
+
+    // Simple-graph degrees: out-degree plus in-degree in the orientation
+    for (int r = 0; r < n; r++)
+    {
+        degree[r] += csrDegree(oriented, r);
+        for (long long e = oriented->offsets[r]; e < oriented->offsets[r + 1]; e++)
+            degree[oriented->neighbors[e]]++;
+    }
+
+    double triples = 0, clusteringSum = 0;
+    for (int r = 0; r < n; r++)
+    {
+        double pairs = (double)degree[r] * (degree[r] - 1) / 2;
+        triples += pairs;
+        if (perVertex && pairs > 0)
+            clusteringSum += context.perVertex[r] / pairs;
+    }
+    result->transitivity = triples > 0 ? 3.0 * result->triangles / triples : 0;
+
+    if (perVertex)
+    {
+        // Back from ranks to the caller's vertex ids
+        result->perVertex = (long long *)malloc((n > 0 ? n : 1) * sizeof(long long));
+        if (result->perVertex != NULL)
+        {
+            for (int r = 0; r < n; r++)
+                result->perVertex[order[r]] = context.perVertex[r];
+        }
+        result->averageClustering = n > 0 ? clusteringSum / n : 0;
+    }
+
+    free(context.perVertex);
+    free(context.threadCounts);
+    free(degree);
+    free(order);
+    freeCSRGraph(oriented);
+    return result;
+}
+
+void freeTriangleResult(TriangleResult *result)
+{
+    if (result == NULL)
+        return;
+    free(result->perVertex);
+    free(result);
+}
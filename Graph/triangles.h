@@ -0,0 +1,55 @@
+#ifndef TRIANGLES_H
+#define TRIANGLES_H
+
+#include "csr_graph.h"
+
+/*
+ * ============================================================================
+ * TRIANGLE COUNTING AND CLUSTERING COEFFICIENTS
+ * ============================================================================
+ *
+ * 1. Degree ordering: vertices are relabeled by (degree, id), so rank 0
+ *    is the lowest-degree vertex.
+ * 2. Orientation: every undirected edge is kept once, pointing from the
+ *    lower to the higher rank. Each triangle is then found exactly once,
+ *    and no out-list is longer than O(sqrt(m)), however skewed the degrees.
+ *    Self loops and duplicate arcs are dropped here.
+ * 3. Counting: for every arc u -> v, |N+(u) ∩ N+(v)| triangles close on
+ *    it. Intersections are either
+ *      merge  - two sorted lists, 4 x 4 blocks compared at once with SSE2
+ *               (scalar merge when SSE2 is not available)
+ *      bitset - N+(u) is marked in a per-thread bitset once, then every
+ *               N+(v) is probed in O(1) per element; used for dense u
+ *               (out-degree >= TRIANGLE_DENSE_DEGREE)
+ *    Vertices are handed to threads in small blocks from a shared counter
+ *    (dynamic scheduling), since the work per vertex is very uneven.
+ *
+ * The input must be symmetric (csrFromEdges with symmetrize = 1).
+ * ============================================================================
+ */
+
+#define TRIANGLE_DENSE_DEGREE 256
+
+typedef enum IntersectMode
+{
+    INTERSECT_AUTO,         // SIMD merge, bitset for dense vertices
+    INTERSECT_SCALAR,       // plain merge everywhere
+    INTERSECT_SIMD,         // SIMD merge everywhere
+    INTERSECT_BITSET        // bitset everywhere
+} IntersectMode;
+
+typedef struct TriangleResult
+{
+    long long triangles;
+    long long *perVertex;       // triangles through each vertex, or NULL
+    double transitivity;        // 3 * triangles / connected triples
+    double averageClustering;   // mean local coefficient (needs perVertex)
+    double orientSeconds;
+    double countSeconds;
+} TriangleResult;
+
+CSRGraph *orientByDegree(const CSRGraph *graph, int threads, int **order);
+TriangleResult *countTriangles(const CSRGraph *graph, int threads, IntersectMode mode, int perVertex);
+void freeTriangleResult(TriangleResult *result);
+
+#endif
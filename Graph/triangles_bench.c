@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "triangles.h"
+#include "graph_gen.h"
+#include "parallel.h"
+
+/*
+ * Test driver / benchmark for triangles.c
+ *
+ * Counts the triangles of an R-MAT graph with every intersection kernel
+ * and checks them against a direct count on the undirected lists
+ * (binary search, no orientation); per-vertex counts must sum to 3x.
+ *
+ * Build: gcc -O2 -pthread parallel.c graph_gen.c csr_graph.c triangles.c triangles_bench.c -o triangles
+ * Usage: ./triangles [scale] [edgeFactor] [threads]
+ *        ./triangles --cache <file.csr> [threads]
+ */
+
+static int contains(const int *list, long long count, int value)
+{
+    long long low = 0, high = count - 1;
+    while (low <= high)
+    {
+        long long mid = low + (high - low) / 2;
+        if (list[mid] == value)
+            return 1;
+        if (list[mid] < value)
+            low = mid + 1;
+        else
+            high = mid - 1;
+    }
+    return 0;
+}
+
+/*
+ * referenceCount - Triangles u < v < w by id; duplicates are skipped
+ */
+static long long referenceCount(const CSRGraph *graph)
+{
+    long long triangles = 0;
+
+    for (int u = 0; u < graph->n; u++)
+    {
+        const int *nu = graph->neighbors + graph->offsets[u];
+        long long du = csrDegree(graph, u);
+
+        for (long long i = 0; i < du; i++)
+        {
+            int v = nu[i];
+            if (v <= u || (i > 0 && nu[i - 1] == v))
+                continue;
+
+            const int *nv = graph->neighbors + graph->offsets[v];
+            long long dv = csrDegree(graph, v);
+            for (long long j = 0; j < dv; j++)
+            {
+                int w = nv[j];
+                if (w <= v || (j > 0 && nv[j - 1] == w))
+                    continue;
+                triangles += contains(nu, du, w);
+            }
+        }
+    }
+    return triangles;
+}
+
+int main(int argc, char **argv)
+{
+    CSRGraph *graph;
+    int threads;
+
+    if (argc > 2 && strcmp(argv[1], "--cache") == 0)
+    {
+        graph = csrLoadCache(argv[2]);
+        threads = (argc > 3) ? atoi(argv[3]) : defaultThreadCount();
+        if (graph == NULL)
+            return 1;
+        printf("%s: %d vertices, %lld arcs, %d threads\n", argv[2], graph->n, graph->m, threads);
+    }
+    else
+    {
+        int scale = (argc > 1) ? atoi(argv[1]) : 18;
+        int edgeFactor = (argc > 2) ? atoi(argv[2]) : 16;
+        threads = (argc > 3) ? atoi(argv[3]) : defaultThreadCount();
+
+        long long m = (long long)edgeFactor << scale;
+        Edge *edges = generateRMATEdges(scale, m, 1);
+        graph = csrFromEdges(edges, m, 1 << scale, 1, threads);
+        free(edges);
+        if (graph == NULL)
+            return 1;
+        printf("R-MAT scale %d: %d vertices, %lld arcs, %d threads\n", scale, graph->n, graph->m, threads);
+    }
+
+    long long expected = referenceCount(graph);
+    printf("reference count: %lld triangles\n\n", expected);
+
+    const char *modeNames[] = {"auto (SIMD + bitset)", "scalar merge", "SIMD merge", "bitset",
+                               "auto + per-vertex"};
+    int allOk = 1;
+
+    // The last run repeats auto with per-vertex counts and clustering
+    for (int run = 0; run <= INTERSECT_BITSET + 1; run++)
+    {
+        int mode = run <= INTERSECT_BITSET ? run : INTERSECT_AUTO;
+        int perVertex = run > INTERSECT_BITSET;
+        TriangleResult *result = countTriangles(graph, threads, (IntersectMode)mode, perVertex);
+        if (result == NULL)
+            return 1;
+
+        int ok = result->triangles == expected;
+        if (result->perVertex != NULL)
+        {
+            long long sum = 0;
+            for (int v = 0; v < graph->n; v++)
+                sum += result->perVertex[v];
+            ok = ok && sum == 3 * expected;
+        }
+        allOk = allOk && ok;
+
+        printf("  %-22s orient %8.3f ms  count %9.3f ms  %lld  %s\n", modeNames[run],
+               result->orientSeconds * 1e3, result->countSeconds * 1e3, result->triangles,
+               ok ? "OK" : "MISMATCH");
+        if (perVertex)
+            printf("  %-22s transitivity %.5f, average clustering %.5f\n", "",
+                   result->transitivity, result->averageClustering);
+        freeTriangleResult(result);
+    }
+
+    freeCSRGraph(graph);
+    return allOk ? 0 : 1;
+}
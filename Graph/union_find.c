@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "union_find.h"
+
+/*
+ * createUnionFind - Creates n singleton sets {0}, {1}, ..., {n-1}
+ *
+ * Returns: pointer to the structure, or NULL if allocation failed
+ *
+ * Time Complexity: O(n)
+ */
+UnionFind *createUnionFind(int n)
+{
+    UnionFind *uf = (UnionFind *)malloc(sizeof(UnionFind));
+    if (uf == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    uf->n = n;
+    uf->parent = (int *)malloc(n * sizeof(int));
+    uf->size = (int *)malloc(n * sizeof(int));
+    if (uf->parent == NULL || uf->size == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        freeUnionFind(uf);
+        return NULL;
+    }
+
+    ufReset(uf);
+    return uf;
+}
+
+void freeUnionFind(UnionFind *uf)
+{
+    if (uf == NULL)
+        return;
+    free(uf->parent);
+    free(uf->size);
+    free(uf);
+}
+
+/*
+ * ufReset - Puts every vertex back into its own set
+ */
+void ufReset(UnionFind *uf)
+{
+    for (int v = 0; v < uf->n; v++)
+    {
+        uf->parent[v] = v;
+        uf->size[v] = 1;
+    }
+    uf->components = uf->n;
+}
+
+/*
+ * ufFind - Returns the root of v's set, compressing with path halving
+ *
+ * Every visited node is pointed at its grandparent, which halves the
+ * path length in one pass without recursion:
+ *
+ *   before: v -> a -> b -> c -> root
+ *   after:  v -> b -> root,  a -> b,  c -> root
+ *
+ * Time Complexity: O(α(n)) amortized
+ */
+int ufFind(UnionFind *uf, int v)
+{
+    int *parent = uf->parent;
+
+    while (parent[v] != v)
+    {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+    }
+    return v;
+}
+
+/*
+ * ufFindSplitting - Same as ufFind but with path splitting: every node
+ * on the path (not every other one) is pointed at its grandparent
+ *
+ * Time Complexity: O(α(n)) amortized
+ */
+int ufFindSplitting(UnionFind *uf, int v)
+{
+    int *parent = uf->parent;
+
+    while (parent[v] != v)
+    {
+        int next = parent[v];
+        parent[v] = parent[next];
+        v = next;
+    }
+    return v;
+}
+
+/*
+ * ufUnion - Merges the sets containing u and v
+ *
+ * Returns: 1 if two sets were merged, 0 if u and v were already connected
+ *
+ * Union by size: the root of the smaller set is attached under the
+ * root of the larger one (session.txt always attached rootu under rootv).
+ *
+ * Time Complexity: O(α(n)) amortized
+ */
+int ufUnion(UnionFind *uf, int u, int v)
+{
+    int rootu = ufFind(uf, u);
+    int rootv = ufFind(uf, v);
+
+    if (rootu == rootv)
+        return 0;
+
+    if (uf->size[rootu] > uf->size[rootv])
+    {
+        int temp = rootu;
+        rootu = rootv;
+        rootv = temp;
+    }
+
+    /// merge: smaller root under larger root ///
+    uf->parent[rootu] = rootv;
+    uf->size[rootv] += uf->size[rootu];
+    uf->components--;
+
+    return 1;
+}
+
+int ufConnected(UnionFind *uf, int u, int v)
+{
+    return ufFind(uf, u) == ufFind(uf, v);
+}
+
+/*
+ * ufComponentSize - Number of vertices in v's set
+ */
+int ufComponentSize(UnionFind *uf, int v)
+{
+    return uf->size[ufFind(uf, v)];
+}
+
+int ufComponentCount(UnionFind *uf)
+{
+    return uf->components;
+}
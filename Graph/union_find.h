@@ -0,0 +1,40 @@
+#ifndef UNION_FIND_H
+#define UNION_FIND_H
+
+/*
+ * ============================================================================
+ * DISJOINT-SET (UNION-FIND)
+ * ============================================================================
+ *
+ * Production version of the sketch in session.txt:
+ *
+ *   - parent[] and size[] are flat int arrays (no per-node allocation)
+ *   - union by size: the smaller tree is hung under the larger root,
+ *     so tree height stays O(log n) even without compression
+ *   - find is iterative (no recursion, no stack overflow on long chains)
+ *     and compresses with path halving or path splitting
+ *
+ * With both heuristics every operation is O(α(n)) amortized.
+ * ============================================================================
+ */
+
+typedef struct UnionFind
+{
+    int *parent;        // parent[v] == v for a root
+    int *size;          // only meaningful at roots: vertices in the set
+    int n;
+    int components;     // number of disjoint sets
+} UnionFind;
+
+UnionFind *createUnionFind(int n);
+void freeUnionFind(UnionFind *uf);
+void ufReset(UnionFind *uf);
+
+int ufFind(UnionFind *uf, int v);
+int ufFindSplitting(UnionFind *uf, int v);
+int ufUnion(UnionFind *uf, int u, int v);
+int ufConnected(UnionFind *uf, int u, int v);
+int ufComponentSize(UnionFind *uf, int v);
+int ufComponentCount(UnionFind *uf);
+
+#endif
@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "union_find.h"
+
+/*
+ * Test driver / benchmark for union_find.c
+ *
+ * Streams random edges (generated on the fly, nothing is stored) through
+ * three variants:
+ *   - union by size + path halving   (ufUnion)
+ *   - union by size + path splitting (ufFindSplitting)
+ *   - session.txt linking (rootu always under rootv) + path halving
+ *
+ * Build: gcc -O2 union_find.c union_find_bench.c -o uf
+ * Usage: ./uf [vertices] [edges]      (default 10M vertices, 100M edges)
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned long long nextRandom(unsigned long long *state)
+{
+    // xorshift64
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/*
+ * naiveUnion - The session.txt merge: no size heuristic
+ */
+static int naiveUnion(UnionFind *uf, int u, int v)
+{
+    int rootu = ufFind(uf, u);
+    int rootv = ufFind(uf, v);
+    if (rootu == rootv)
+        return 0;
+    uf->parent[rootu] = rootv;
+    uf->size[rootv] += uf->size[rootu];
+    uf->components--;
+    return 1;
+}
+
+static int splittingUnion(UnionFind *uf, int u, int v)
+{
+    int rootu = ufFindSplitting(uf, u);
+    int rootv = ufFindSplitting(uf, v);
+    if (rootu == rootv)
+        return 0;
+    if (uf->size[rootu] > uf->size[rootv])
+    {
+        int temp = rootu;
+        rootu = rootv;
+        rootv = temp;
+    }
+    uf->parent[rootu] = rootv;
+    uf->size[rootv] += uf->size[rootu];
+    uf->components--;
+    return 1;
+}
+
+static void runStream(const char *name, UnionFind *uf, long long edges,
+                      int (*unite)(UnionFind *, int, int))
+{
+    unsigned long long state = 88172645463325252ULL;
+    ufReset(uf);
+
+    double start = nowSeconds();
+    for (long long e = 0; e < edges; e++)
+    {
+        int u = (int)(nextRandom(&state) % uf->n);
+        int v = (int)(nextRandom(&state) % uf->n);
+        unite(uf, u, v);
+    }
+    double elapsed = nowSeconds() - start;
+
+    int largest = 0;
+    for (int v = 0; v < uf->n; v++)
+    {
+        if (uf->parent[v] == v && uf->size[v] > largest)
+            largest = uf->size[v];
+    }
+
+    printf("  %-28s %6.2f s  %7.1f M edges/s  components=%d  largest=%d\n",
+           name, elapsed, edges / elapsed / 1e6, ufComponentCount(uf), largest);
+}
+
+int main(int argc, char **argv)
+{
+    // ---- Small correctness demo ----
+    UnionFind *uf = createUnionFind(8);
+    ufUnion(uf, 0, 1);
+    ufUnion(uf, 2, 3);
+    ufUnion(uf, 1, 3);
+    ufUnion(uf, 5, 6);
+    printf("Sets after {0-1, 2-3, 1-3, 5-6}: components=%d\n", ufComponentCount(uf));     // 4
+    printf("connected(0, 2) = %d, connected(0, 5) = %d\n", ufConnected(uf, 0, 2), ufConnected(uf, 0, 5));
+    printf("size(3) = %d, size(6) = %d, size(7) = %d\n",
+           ufComponentSize(uf, 3), ufComponentSize(uf, 6), ufComponentSize(uf, 7));     // 4 2 1
+    freeUnionFind(uf);
+
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    long long edges = (argc > 2) ? atoll(argv[2]) : 100000000LL;
+
+    // ---- Long chain: recursive find in session.txt would overflow the stack ----
+    uf = createUnionFind(n);
+    for (int v = 0; v + 1 < n; v++)
+        naiveUnion(uf, v, v + 1);       // builds 0 -> 1 -> 2 -> ... -> n-1
+    double start = nowSeconds();
+    int root = ufFind(uf, 0);
+    printf("\nChain of %d nodes: find(0) = %d in %.3f s (iterative, no recursion)\n",
+           n, root, nowSeconds() - start);
+
+    // ---- Random edge stream ----
+    printf("\n%lld random edges over %d vertices:\n", edges, n);
+    runStream("size + path halving", uf, edges, ufUnion);
+    runStream("size + path splitting", uf, edges, splittingUnion);
+    runStream("session.txt link + halving", uf, edges, naiveUnion);
+
+    freeUnionFind(uf);
+    return 0;
+}
@@ -0,0 +1,325 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "concurrent_skip_list.h"
+
+#define MARK ((uintptr_t)1)
+
+static inline struct CSkipNode *pointerOf(uintptr_t link)
+{
+    return (struct CSkipNode *)(link & ~MARK);
+}
+
+static inline int isMarked(uintptr_t link)
+{
+    return (int)(link & MARK);
+}
+
+/*
+ * randomHeight - Geometric height (p = 1/4) from a per-thread xorshift64*
+ *
+ * The state is thread-local so inserting threads never share a cache line
+ * just to roll a height.
+ */
+static int randomHeight(void)
+{
+    static _Thread_local unsigned long long state;
+    if (state == 0)
+        state = ((unsigned long long)(uintptr_t)&state | 1) * 0x9E3779B97F4A7C15ULL;
+
+    unsigned long long x = state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    state = x;
+    x *= 0x2545F4914F6CDD1DULL;
+
+    int height = 1 + __builtin_ctzll(x | (1ULL << 63)) / 2;
+    return height < SKIP_MAX_LEVEL ? height : SKIP_MAX_LEVEL;
+}
+
+/*
+ * createCSkipNode - Allocates a node and pushes it on list->allocated
+ *
+ * Returns: the node, or NULL if allocation failed
+ */
+static struct CSkipNode *createCSkipNode(ConcurrentSkipList *list, int value, int height)
+{
+    struct CSkipNode *node = (struct CSkipNode *)malloc(sizeof(struct CSkipNode) +
+                                                        height * sizeof(atomic_uintptr_t));
+    if (node == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+    node->data = value;
+    node->height = height;
+    for (int level = 0; level < height; level++)
+        atomic_init(&node->Next[level], (uintptr_t)0);
+
+    struct CSkipNode *top = atomic_load_explicit(&list->allocated, memory_order_relaxed);
+    do
+        node->allocatedNext = top;
+    while (!atomic_compare_exchange_weak_explicit(&list->allocated, &top, node,
+                                                  memory_order_release, memory_order_relaxed));
+    return node;
+}
+
+/*
+ * findNodes - Fills preds[] / succs[] around value on every level,
+ * unlinking any marked node it passes
+ *
+ * succs[level] is the first unmarked node with data >= value (or NULL)
+ * and preds[level] the node before it. If unlinking fails because pred
+ * changed under us, the whole search restarts from the head.
+ *
+ * Returns: 1 if succs[0] holds value
+ */
+static int findNodes(ConcurrentSkipList *list, int value,
+                     struct CSkipNode **preds, struct CSkipNode **succs)
+{
+retry:;
+    struct CSkipNode *pred = list->head;
+    struct CSkipNode *curr = NULL;
+
+    for (int level = SKIP_MAX_LEVEL - 1; level >= 0; level--)
+    {
+        curr = pointerOf(atomic_load(&pred->Next[level]));
+        while (curr != NULL)
+        {
+            uintptr_t succ = atomic_load(&curr->Next[level]);
+            while (isMarked(succ))
+            {
+                uintptr_t expected = (uintptr_t)curr;
+                if (!atomic_compare_exchange_strong(&pred->Next[level], &expected, succ & ~MARK))
+                    goto retry;
+                curr = pointerOf(succ);
+                if (curr == NULL)
+                    break;
+                succ = atomic_load(&curr->Next[level]);
+            }
+            if (curr == NULL || curr->data >= value)
+                break;
+            pred = curr;
+            curr = pointerOf(succ);
+        }
+        preds[level] = pred;
+        succs[level] = curr;
+    }
+    return curr != NULL && curr->data == value;
+}
+
+/*
+ * createConcurrentSkipList - Makes an empty list
+ *
+ * Returns: pointer to the list, or NULL if allocation failed
+ */
+ConcurrentSkipList *createConcurrentSkipList(void)
+{
+    ConcurrentSkipList *list = (ConcurrentSkipList *)malloc(sizeof(ConcurrentSkipList));
+    if (list == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+    atomic_init(&list->allocated, NULL);
+    atomic_init(&list->size, 0);
+    list->head = createCSkipNode(list, 0, SKIP_MAX_LEVEL);
+    if (list->head == NULL)
+    {
+        free(list);
+        return NULL;
+    }
+    return list;
+}
+
+/*
+ * freeConcurrentSkipList - Frees every node ever allocated, linked or not
+ *
+ * Only call once no other thread uses the list.
+ */
+void freeConcurrentSkipList(ConcurrentSkipList *list)
+{
+    if (list == NULL)
+        return;
+
+    struct CSkipNode *node = atomic_load(&list->allocated);
+    while (node != NULL)
+    {
+        struct CSkipNode *next = node->allocatedNext;
+        free(node);
+        node = next;
+    }
+    free(list);
+}
+
+/*
+ * cslInsert - Adds value if it is not already present
+ *
+ * Returns: 1 if inserted, 0 if the value was already there,
+ *          -1 if allocation failed (the list is unchanged)
+ *
+ * Time Complexity: O(log n) expected, lock-free
+ */
+int cslInsert(ConcurrentSkipList *list, int value)
+{
+    struct CSkipNode *preds[SKIP_MAX_LEVEL];
+    struct CSkipNode *succs[SKIP_MAX_LEVEL];
+    struct CSkipNode *node = NULL;
+    int height = randomHeight();
+
+    // Level 0: the linearization point
+    for (;;)
+    {
+        if (findNodes(list, value, preds, succs))
+            return 0;           // a node that lost the race stays on `allocated`
+
+        if (node == NULL)
+        {
+            node = createCSkipNode(list, value, height);
+            if (node == NULL)
+                return -1;
+        }
+        for (int level = 0; level < height; level++)
+            atomic_store_explicit(&node->Next[level], (uintptr_t)succs[level], memory_order_relaxed);
+
+        uintptr_t expected = (uintptr_t)succs[0];
+        if (atomic_compare_exchange_strong(&preds[0]->Next[0], &expected, (uintptr_t)node))
+            break;
+    }
+    atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+
+    // Upper levels: only speed up later searches, so a concurrent delete
+    // of this node simply ends the linking
+    for (int level = 1; level < height; level++)
+    {
+        for (;;)
+        {
+            uintptr_t link = atomic_load(&node->Next[level]);
+            if (isMarked(link))
+                return 1;
+            if (pointerOf(link) != succs[level] &&
+                !atomic_compare_exchange_strong(&node->Next[level], &link, (uintptr_t)succs[level]))
+                continue;       // raced with a delete marking this level
+
+            uintptr_t expected = (uintptr_t)succs[level];
+            if (atomic_compare_exchange_strong(&preds[level]->Next[level], &expected, (uintptr_t)node))
+                break;
+
+            findNodes(list, value, preds, succs);
+            if (succs[0] != node)
+                return 1;       // already deleted again
+        }
+    }
+    return 1;
+}
+
+/*
+ * cslDelete - Removes value if present
+ *
+ * Returns: 1 if this call removed it, 0 if it was not there (or another
+ *          thread removed it first)
+ *
+ * Time Complexity: O(log n) expected, lock-free
+ */
+int cslDelete(ConcurrentSkipList *list, int value)
+{
+    struct CSkipNode *preds[SKIP_MAX_LEVEL];
+    struct CSkipNode *succs[SKIP_MAX_LEVEL];
+
+    if (!findNodes(list, value, preds, succs))
+        return 0;
+    struct CSkipNode *node = succs[0];
+
+    // Mark the upper levels, top first; nobody can link past a marked link
+    for (int level = node->height - 1; level >= 1; level--)
+    {
+        uintptr_t link = atomic_load(&node->Next[level]);
+        while (!isMarked(link))
+        {
+            if (atomic_compare_exchange_weak(&node->Next[level], &link, link | MARK))
+                break;
+        }
+    }
+
+    // Marking level 0 decides which deleter wins
+    uintptr_t link = atomic_load(&node->Next[0]);
+    for (;;)
+    {
+        if (isMarked(link))
+            return 0;
+        if (atomic_compare_exchange_weak(&node->Next[0], &link, link | MARK))
+            break;
+    }
+    atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+
+    findNodes(list, value, preds, succs);           // unlinks the marked node
+    return 1;
+}
+
+/*
+ * cslContains - 1 if value is present, 0 otherwise
+ *
+ * Read-only: marked nodes are stepped over, not unlinked.
+ *
+ * Time Complexity: O(log n) expected, wait-free
+ */
+int cslContains(ConcurrentSkipList *list, int value)
+{
+    struct CSkipNode *pred = list->head;
+    struct CSkipNode *curr = NULL;
+
+    for (int level = SKIP_MAX_LEVEL - 1; level >= 0; level--)
+    {
+        curr = pointerOf(atomic_load(&pred->Next[level]));
+        while (curr != NULL)
+        {
+            uintptr_t succ = atomic_load(&curr->Next[level]);
+            if (isMarked(succ))
+            {
+                curr = pointerOf(succ);
+                continue;
+            }
+            if (curr->data >= value)
+                break;
+            pred = curr;
+            curr = pointerOf(succ);
+        }
+    }
+    return curr != NULL && curr->data == value;
+}
+
+/*
+ * cslForEachInRange - Calls visit on every unmarked value in [low, high]
+ *
+ * Weakly consistent: values inserted or deleted during the walk may or
+ * may not be seen, but each value is visited at most once, in order.
+ *
+ * Returns: number of values visited
+ */
+long long cslForEachInRange(ConcurrentSkipList *list, int low, int high,
+                            SkipVisit visit, void *context)
+{
+    struct CSkipNode *preds[SKIP_MAX_LEVEL];
+    struct CSkipNode *succs[SKIP_MAX_LEVEL];
+    findNodes(list, low, preds, succs);
+
+    long long visited = 0;
+    struct CSkipNode *node = succs[0];
+    while (node != NULL && node->data <= high)
+    {
+        uintptr_t next = atomic_load(&node->Next[0]);
+        if (!isMarked(next))
+        {
+            visited++;
+            if (visit != NULL && visit(node->data, context))
+                break;
+        }
+        node = pointerOf(next);
+    }
+    return visited;
+}
+
+int cslSize(ConcurrentSkipList *list)
+{
+    return atomic_load_explicit(&list->size, memory_order_relaxed);
+}
@@ -0,0 +1,57 @@
+#ifndef CONCURRENT_SKIP_LIST_H
+#define CONCURRENT_SKIP_LIST_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include "skip_list.h"
+
+/*
+ * ============================================================================
+ * LOCK-FREE CONCURRENT SKIP LIST
+ * ============================================================================
+ *
+ * Same towers as skip_list.c, but every link is atomic and any number of
+ * threads can insert, delete and search at once (Fraser / Herlihy-Shavit):
+ *
+ *   insert: find the predecessors, CAS the node into level 0 (this is the
+ *           moment it becomes visible), then CAS it into each higher level
+ *           (retrying with fresh predecessors if a CAS fails)
+ *   delete: set the low "marked" bit of the node's links, top level first;
+ *           whoever marks Next[0] owns the delete. Marked nodes are
+ *           unlinked by the next traversal that trips over them.
+ *   search: never writes, just steps over marked nodes (wait-free)
+ *
+ * It is a set: inserting a value that is already there returns 0.
+ *
+ * Unlinked nodes are NOT freed while the list is in use (another thread may
+ * still be standing on one). Every node is pushed on an `allocated` chain
+ * and all of them are freed by freeConcurrentSkipList.
+ * ============================================================================
+ */
+
+struct CSkipNode
+{
+    int data;
+    int height;
+    struct CSkipNode *allocatedNext;    // chain of every node ever allocated
+    atomic_uintptr_t Next[];            // struct CSkipNode * | mark bit
+};
+
+typedef struct ConcurrentSkipList
+{
+    struct CSkipNode *head;             // sentinel with SKIP_MAX_LEVEL levels
+    _Atomic(struct CSkipNode *) allocated;
+    atomic_int size;
+} ConcurrentSkipList;
+
+ConcurrentSkipList *createConcurrentSkipList(void);
+void freeConcurrentSkipList(ConcurrentSkipList *list);
+
+int cslInsert(ConcurrentSkipList *list, int value);
+int cslDelete(ConcurrentSkipList *list, int value);
+int cslContains(ConcurrentSkipList *list, int value);
+long long cslForEachInRange(ConcurrentSkipList *list, int low, int high,
+                            SkipVisit visit, void *context);
+int cslSize(ConcurrentSkipList *list);
+
+#endif
@@ -0,0 +1,202 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "epoch.h"
+
+/*
+ * releaseBucket - Hands every object of a bucket to the release callback
+ */
+static void releaseBucket(EpochDomain *domain, EpochBucket *bucket)
+{
+    for (int i = 0; i < bucket->count; i++)
+        domain->release(bucket->objects[i]);
+    bucket->count = 0;
+}
+
+/*
+ * reclaim - Releases the thread's buckets that are at least two epochs old
+ */
+static void reclaim(EpochDomain *domain, EpochThread *self)
+{
+    unsigned long long global = __atomic_load_n(&domain->global, __ATOMIC_ACQUIRE);
+    for (int b = 0; b < EPOCH_BUCKETS; b++)
+    {
+        EpochBucket *bucket = &self->limbo[b];
+        if (bucket->count > 0 && bucket->epoch + 2 <= global)
+            releaseBucket(domain, bucket);
+    }
+}
+
+/*
+ * createEpochDomain - Makes a domain for up to maxThreads threads
+ * @release: called on every retired object once it is safe (e.g. free)
+ *
+ * Returns: pointer to the domain, or NULL if allocation failed
+ */
+EpochDomain *createEpochDomain(int maxThreads, EpochRelease release)
+{
+    if (maxThreads < 1)
+        maxThreads = 1;
+
+    EpochDomain *domain = (EpochDomain *)malloc(sizeof(EpochDomain));
+    EpochThread *threads = (EpochThread *)aligned_alloc(64, maxThreads * sizeof(EpochThread));
+    if (domain == NULL || threads == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(domain);
+        free(threads);
+        return NULL;
+    }
+
+    for (int t = 0; t < maxThreads; t++)
+    {
+        threads[t].announced = 0;
+        threads[t].retiredSinceAdvance = 0;
+        for (int b = 0; b < EPOCH_BUCKETS; b++)
+        {
+            threads[t].limbo[b].objects = NULL;
+            threads[t].limbo[b].count = 0;
+            threads[t].limbo[b].capacity = 0;
+            threads[t].limbo[b].epoch = 0;
+        }
+    }
+
+    domain->global = 2;             // so "epoch + 2 <= global" never underflows
+    domain->threads = threads;
+    domain->maxThreads = maxThreads;
+    domain->release = release;
+    return domain;
+}
+
+/*
+ * freeEpochDomain - Releases every object still in limbo and frees the
+ * domain; no thread may be inside a read section
+ */
+void freeEpochDomain(EpochDomain *domain)
+{
+    if (domain == NULL)
+        return;
+
+    for (int t = 0; t < domain->maxThreads; t++)
+    {
+        for (int b = 0; b < EPOCH_BUCKETS; b++)
+        {
+            releaseBucket(domain, &domain->threads[t].limbo[b]);
+            free(domain->threads[t].limbo[b].objects);
+        }
+    }
+    free(domain->threads);
+    free(domain);
+}
+
+/*
+ * epochEnter - Starts a read section: pointers loaded from the shared
+ * structure stay valid until epochExit
+ *
+ * The fence orders the announcement before every later load, so an
+ * advancing thread either sees us active or we see its new epoch.
+ *
+ * Time Complexity: O(1), no shared writes
+ */
+void epochEnter(EpochDomain *domain, int thread)
+{
+    unsigned long long global = __atomic_load_n(&domain->global, __ATOMIC_ACQUIRE);
+    __atomic_store_n(&domain->threads[thread].announced, (global << 1) | 1, __ATOMIC_SEQ_CST);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+void epochExit(EpochDomain *domain, int thread)
+{
+    __atomic_store_n(&domain->threads[thread].announced, 0, __ATOMIC_RELEASE);
+}
+
+/*
+ * epochTryAdvance - Moves the global epoch on if every active thread has
+ * announced the current one
+ *
+ * Returns: 1 if the epoch advanced (by this or a racing call), 0 if some
+ *          reader still lags behind
+ *
+ * Time Complexity: O(maxThreads)
+ */
+int epochTryAdvance(EpochDomain *domain)
+{
+    unsigned long long global = __atomic_load_n(&domain->global, __ATOMIC_SEQ_CST);
+    for (int t = 0; t < domain->maxThreads; t++)
+    {
+        unsigned long long announced = __atomic_load_n(&domain->threads[t].announced, __ATOMIC_SEQ_CST);
+        if ((announced & 1) && (announced >> 1) != global)
+            return 0;
+    }
+    __atomic_compare_exchange_n(&domain->global, &global, global + 1, 0,
+                                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+    return 1;
+}
+
+/*
+ * epochRetire - Defers release of an object that was just unlinked
+ * @thread: the retiring thread's index (it need not be in a read section)
+ *
+ * The object goes into the bucket of the current epoch. A bucket still
+ * holding objects from an older epoch (>= 3 back) is released first;
+ * every EPOCH_ADVANCE_EVERY retires the thread also tries to advance and
+ * releases whatever became safe.
+ *
+ * The fence orders the caller's unlink before the load of the epoch.
+ * Without it a second writer could advance to e + 1, a reader announce
+ * e + 1 and still see the old link, and this call file the object under
+ * e, which is released at e + 2 while that reader may still hold it.
+ *
+ * Time Complexity: O(1) amortized (O(maxThreads) every
+ *                  EPOCH_ADVANCE_EVERY calls)
+ */
+void epochRetire(EpochDomain *domain, int thread, void *object)
+{
+    EpochThread *self = &domain->threads[thread];
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    unsigned long long global = __atomic_load_n(&domain->global, __ATOMIC_SEQ_CST);
+    EpochBucket *bucket = &self->limbo[global % EPOCH_BUCKETS];
+
+    if (bucket->epoch != global)
+    {
+        if (bucket->count > 0)
+            releaseBucket(domain, bucket);          // epoch global - 3 or older
+        bucket->epoch = global;
+    }
+
+    if (bucket->count == bucket->capacity)
+    {
+        int capacity = bucket->capacity ? bucket->capacity * 2 : 64;
+        void **objects = (void **)realloc(bucket->objects, capacity * sizeof(void *));
+        if (objects == NULL)
+        {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        bucket->objects = objects;
+        bucket->capacity = capacity;
+    }
+    bucket->objects[bucket->count++] = object;
+
+    if (++self->retiredSinceAdvance >= EPOCH_ADVANCE_EVERY)
+    {
+        self->retiredSinceAdvance = 0;
+        epochTryAdvance(domain);
+        reclaim(domain, self);
+    }
+}
+
+/*
+ * epochPending - Objects retired but not yet released, over all threads
+ *
+ * Only exact while no thread retires concurrently; meant for statistics.
+ */
+long long epochPending(EpochDomain *domain)
+{
+    long long pending = 0;
+    for (int t = 0; t < domain->maxThreads; t++)
+    {
+        for (int b = 0; b < EPOCH_BUCKETS; b++)
+            pending += domain->threads[t].limbo[b].count;
+    }
+    return pending;
+}
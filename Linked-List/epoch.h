@@ -0,0 +1,70 @@
+#ifndef EPOCH_H
+#define EPOCH_H
+
+/*
+ * ============================================================================
+ * EPOCH-BASED RECLAMATION
+ * ============================================================================
+ *
+ * Lets writers unlink a node while readers may still be standing on it,
+ * without readers taking any lock. A writer does not free() an unlinked
+ * node; it retires it, and the node is freed once every reader that could
+ * have seen it has left.
+ *
+ *   global epoch  E
+ *   reader:       epochEnter (announce "active in E") ... epochExit
+ *   writer:       unlink node, epochRetire(node)  -> limbo bucket of E
+ *   advance:      E -> E + 1 only when every ACTIVE thread announced E
+ *   free:         a bucket retired in epoch e is freed once E >= e + 2
+ *
+ * Why e + 2: a reader that could reach the node entered no later than e;
+ * reaching E = e + 2 needs two advances, and the second one waits for that
+ * reader to announce e + 1 (i.e. to have left and re-entered).
+ *
+ * Every thread has a fixed index in [0, maxThreads) with its own announced
+ * epoch (one cache line) and three limbo buckets (E mod 3), so retiring
+ * never touches another thread's memory.
+ * ============================================================================
+ */
+
+#define EPOCH_BUCKETS 3
+#define EPOCH_ADVANCE_EVERY 64      // retires between advance attempts
+
+typedef void (*EpochRelease)(void *object);
+
+typedef struct EpochBucket
+{
+    void **objects;
+    int count;
+    int capacity;
+    unsigned long long epoch;       // epoch the objects were retired in
+} EpochBucket;
+
+typedef struct EpochThread
+{
+    unsigned long long announced;   // (epoch << 1) | 1 while active, 0 when idle
+    char padAnnounced[56];          // read by every advancing thread
+    EpochBucket limbo[EPOCH_BUCKETS];
+    int retiredSinceAdvance;
+    char padLimbo[52];              // owner-only, two more cache lines
+} EpochThread;
+
+typedef struct EpochDomain
+{
+    unsigned long long global;
+    char padGlobal[56];
+    EpochThread *threads;
+    int maxThreads;
+    EpochRelease release;
+} EpochDomain;
+
+EpochDomain *createEpochDomain(int maxThreads, EpochRelease release);
+void freeEpochDomain(EpochDomain *domain);
+
+void epochEnter(EpochDomain *domain, int thread);
+void epochExit(EpochDomain *domain, int thread);
+void epochRetire(EpochDomain *domain, int thread, void *object);
+int epochTryAdvance(EpochDomain *domain);
+long long epochPending(EpochDomain *domain);
+
+#endif
@@ -0,0 +1,142 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "singly_linked_list.h"
+
+/*
+ * Benchmark for compactList / compactStep
+ *
+ * 1. Scatter: n nodes allocated in a row, then linked in a random order,
+ *    which is what a long session of insertAtPosition / deleteByValue
+ *    does to the heap
+ * 2. Time a full traversal and a failing search, compactList, time again
+ * 3. Scatter again and compact incrementally in steps of `step` nodes,
+ *    with a search between steps; report the longest pause
+ *
+ * Build: gcc -O2 singly_linked_list.c list_compact_bench.c -o compact
+ * Usage: ./compact [elements] [step]
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * scatteredList - Values 0 .. n-1 in order, on nodes in shuffled addresses
+ */
+static void scatteredList(List *list, int n, unsigned int seed)
+{
+    struct Node **nodes = (struct Node **)malloc((size_t)n * sizeof(struct Node *));
+    if (nodes == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (int i = 0; i < n; i++)
+        nodes[i] = CreateNode(0);
+    for (int i = n - 1; i > 0; i--)
+    {
+        seed = seed * 1103515245u + 12345u;
+        int j = (int)((seed >> 4) % (unsigned int)(i + 1));
+        struct Node *temp = nodes[i];
+        nodes[i] = nodes[j];
+        nodes[j] = temp;
+    }
+
+    initList(list);
+    for (int i = 0; i < n; i++)
+    {
+        nodes[i]->data = i;
+        nodes[i]->Next = (i + 1 < n) ? nodes[i + 1] : NULL;
+    }
+    list->head = nodes[0];
+    list->tail = nodes[n - 1];
+    list->size = n;
+    free(nodes);
+}
+
+static long long traverse(List *list, double *seconds)
+{
+    double start = nowSeconds();
+    long long sum = 0;
+    for (struct Node *curr = list->head; curr != NULL; curr = curr->Next)
+        sum += curr->data;
+    *seconds = nowSeconds() - start;
+    return sum;
+}
+
+static int inOrder(List *list, int n)
+{
+    int expected = 0;
+    for (struct Node *curr = list->head; curr != NULL; curr = curr->Next)
+    {
+        if (curr->data != expected++)
+            return 0;
+    }
+    return expected == n && getLength(list) == n && list->tail->data == n - 1;
+}
+
+int main(int argc, char **argv)
+{
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+    int step = (argc > 2) ? atoi(argv[2]) : 65536;
+    if (n < 1)
+        n = 1;
+    long long expectedSum = (long long)n * (n - 1) / 2;
+
+    List list;
+    scatteredList(&list, n, 1);
+
+    double walkBefore, walkAfter;
+    int ok = traverse(&list, &walkBefore) == expectedSum;
+    double start = nowSeconds();
+    int missing = search(&list, -1);
+    double searchBefore = nowSeconds() - start;
+
+    start = nowSeconds();
+    ok = compactList(&list) == 0 && ok;
+    double compactTime = nowSeconds() - start;
+
+    ok = traverse(&list, &walkAfter) == expectedSum && ok;
+    start = nowSeconds();
+    missing += search(&list, -1);
+    double searchAfter = nowSeconds() - start;
+    ok = ok && missing == -2 && inOrder(&list, n);
+
+    printf("%d scattered nodes\n", n);
+    printf("  traverse      : %7.3f s -> %7.3f s  (%.1fx)\n", walkBefore, walkAfter, walkBefore / walkAfter);
+    printf("  failed search : %7.3f s -> %7.3f s  (%.1fx)\n", searchBefore, searchAfter, searchBefore / searchAfter);
+    printf("  compactList   : %7.3f s\n", compactTime);
+    freeList(&list);
+
+    // ---- Incremental ----
+    scatteredList(&list, n, 2);
+    CompactState state;
+    ok = compactBegin(&list, &state) == 0 && ok;
+
+    int steps = 0, done = 0;
+    double longest = 0, total = 0;
+    while (!done)
+    {
+        start = nowSeconds();
+        done = compactStep(&list, &state, step);
+        double pause = nowSeconds() - start;
+        total += pause;
+        if (pause > longest)
+            longest = pause;
+
+        // The list stays readable between steps
+        if (++steps % 16 == 0)
+            ok = ok && search(&list, n - 1) == n - 1;
+    }
+    ok = ok && inOrder(&list, n) && list.slabs != NULL && list.slabs->next == NULL;
+
+    printf("  incremental   : %d steps of %d nodes, %.3f s total, longest pause %.2f ms\n",
+           steps, step, total, longest * 1e3);
+    printf("%s\n", ok ? "OK" : "MISMATCH");
+    freeList(&list);
+    return ok ? 0 : 1;
+}
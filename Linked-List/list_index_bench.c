@@ -0,0 +1,260 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "singly_linked_list.h"
+#include "list_sort.h"
+
+/*
+ * Test driver / benchmark for the optional list index
+ *
+ * 1. Random mix of every insert / delete path (plus reverse, sort, splice,
+ *    slab append and compaction) on an indexed and a plain list; after each
+ *    step both must hold the same values and every index entry must name
+ *    the first occurrence, its predecessor and the right count
+ * 2. Dedup workload: for a stream of values, "if not contained, append;
+ *    sometimes deleteByValue an old one", with and without the index
+ *
+ * Build: gcc -O2 -pthread ../Graph/parallel.c singly_linked_list.c list_sort.c list_index_bench.c -o listindex
+ * Usage: ./listindex [streamLength]
+ */
+
+static unsigned int state = 2024;
+
+static int randomInt(int bound)
+{
+    state = state * 1103515245u + 12345u;
+    return (int)((state >> 8) % (unsigned int)bound);
+}
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * indexIsConsistent - Checks every entry against a walk of the list
+ */
+static int indexIsConsistent(List *list)
+{
+    ListIndex *index = list->index;
+    int distinct = 0;
+
+    struct Node *pred = NULL;
+    for (struct Node *curr = list->head; curr != NULL; pred = curr, curr = curr->Next)
+    {
+        // Is curr the first occurrence of its value?
+        int first = 1;
+        for (struct Node *p = list->head; p != curr && first; p = p->Next)
+            first = (p->data != curr->data);
+        if (!first)
+            continue;
+
+        int count = 0;
+        for (struct Node *p = curr; p != NULL; p = p->Next)
+            count += (p->data == curr->data);
+
+        IndexEntry *entry = NULL;
+        for (int i = 0; i < index->capacity && entry == NULL; i++)
+        {
+            if (index->slots[i].count != 0 && index->slots[i].key == curr->data)
+                entry = &index->slots[i];
+        }
+        if (entry == NULL || entry->node != curr || entry->pred != pred || entry->count != count)
+            return 0;
+        distinct++;
+    }
+    return distinct == index->used && listContains(list, -12345) == 0;
+}
+
+static int sameContents(List *a, List *b)
+{
+    if (getLength(a) != getLength(b))
+        return 0;
+    struct Node *x = a->head, *y = b->head;
+    for (; x != NULL && y != NULL; x = x->Next, y = y->Next)
+    {
+        if (x->data != y->data)
+            return 0;
+    }
+    return x == NULL && y == NULL && (getLength(a) == 0 || a->tail->data == b->tail->data);
+}
+
+static int randomCheck(int steps)
+{
+    List indexed, plain;
+    initList(&indexed);
+    initList(&plain);
+    enableListIndex(&indexed);
+
+    for (int step = 0; step < steps; step++)
+    {
+        int value = randomInt(40);          // small range: plenty of duplicates
+        int size = getLength(&plain);
+        int got = 0, expected = 0;
+
+        switch (randomInt(size < 30 ? 5 : 14))
+        {
+        case 0:
+            insertAtBeginning(&indexed, value);
+            insertAtBeginning(&plain, value);
+            break;
+        case 1:
+            insertAtEnd(&indexed, value);
+            insertAtEnd(&plain, value);
+            break;
+        case 2:
+        case 3:
+        {
+            int position = randomInt(size + 1);
+            insertAtPosition(&indexed, value, position);
+            insertAtPosition(&plain, value, position);
+            break;
+        }
+        case 4:
+        {
+            int values[3] = {value, randomInt(40), value};
+            appendArray(&indexed, values, 3);
+            appendArray(&plain, values, 3);
+            break;
+        }
+        case 5:
+        case 6:
+        case 7:
+            got = deleteByValue(&indexed, value);
+            expected = deleteByValue(&plain, value);
+            break;
+        case 8:
+        {
+            int position = randomInt(size);
+            got = deleteAtPosition(&indexed, position);
+            expected = deleteAtPosition(&plain, position);
+            break;
+        }
+        case 9:
+            got = deleteFromBeginning(&indexed);
+            expected = deleteFromBeginning(&plain);
+            break;
+        case 10:
+            got = deleteFromEnd(&indexed);
+            expected = deleteFromEnd(&plain);
+            break;
+        case 11:
+            got = search(&indexed, value);
+            expected = search(&plain, value);
+            break;
+        case 12:
+            if (randomInt(2))
+            {
+                reverseList(&indexed);
+                reverseList(&plain);
+            }
+            else
+            {
+                sortList(&indexed);
+                sortList(&plain);
+            }
+            break;
+        case 13:
+        {
+            // Splice a small indexed list on, or compact in two steps
+            if (randomInt(2))
+            {
+                List extra, extraPlain;
+                int values[4] = {value, 1, value, 2};
+                listFromArray(&extra, values, 4);
+                listFromArray(&extraPlain, values, 4);
+                enableListIndex(&extra);
+                appendList(&indexed, &extra);
+                appendList(&plain, &extraPlain);
+            }
+            else
+            {
+                CompactState compact;
+                compactBegin(&indexed, &compact);
+                compactStep(&indexed, &compact, size / 2);
+                got = indexIsConsistent(&indexed);
+                expected = 1;
+                while (!compactStep(&indexed, &compact, 7))
+                    ;
+            }
+            break;
+        }
+        }
+
+        if (got != expected || !sameContents(&indexed, &plain) || !indexIsConsistent(&indexed))
+        {
+            printf("  MISMATCH at step %d\n", step);
+            return 0;
+        }
+    }
+
+    freeList(&indexed);
+    int ok = indexIsConsistent(&indexed) && indexed.index->used == 0;
+    disableListIndex(&indexed);
+    freeList(&plain);
+    return ok;
+}
+
+/*
+ * dedup - Keeps the list free of duplicates while streaming values; every
+ * 4th value also evicts an older one by value
+ *
+ * Returns: checksum of the final list
+ */
+static unsigned long long dedup(List *list, int stream, int range)
+{
+    state = 77;
+    for (int i = 0; i < stream; i++)
+    {
+        int value = randomInt(range);
+        if (!listContains(list, value))
+            insertAtEnd(list, value);
+        if ((i & 3) == 0)
+            deleteByValue(list, randomInt(range));
+    }
+
+    unsigned long long checksum = 0;
+    for (struct Node *curr = list->head; curr != NULL; curr = curr->Next)
+        checksum = checksum * 31 + (unsigned int)curr->data;
+    return checksum;
+}
+
+int main(int argc, char **argv)
+{
+    int stream = (argc > 1) ? atoi(argv[1]) : 1000000;
+
+    int ok = randomCheck(5000);
+    printf("Random operations, indexed vs plain list: %s\n", ok ? "OK" : "FAILED");
+
+    int range = 20000;
+    int plainStream = stream < 100000 ? stream : 100000;
+    printf("\nDedup stream over %d distinct values\n", range);
+
+    List plain;
+    initList(&plain);
+    double start = nowSeconds();
+    unsigned long long plainSum = dedup(&plain, plainStream, range);
+    double plainTime = nowSeconds() - start;
+
+    List indexed;
+    initList(&indexed);
+    enableListIndex(&indexed);
+    start = nowSeconds();
+    unsigned long long indexedSum = dedup(&indexed, plainStream, range);
+    double indexedTime = nowSeconds() - start;
+    ok = ok && plainSum == indexedSum;
+    printf("  %8d values: plain %8.3f s, indexed %8.4f s (%.0fx), same list: %s\n", plainStream,
+           plainTime, indexedTime, plainTime / indexedTime, plainSum == indexedSum ? "yes" : "NO");
+    freeList(&plain);
+    freeList(&indexed);
+
+    start = nowSeconds();
+    dedup(&indexed, stream, range);
+    printf("  %8d values: indexed %8.4f s (%d kept)\n", stream, nowSeconds() - start, getLength(&indexed));
+    freeList(&indexed);
+    disableListIndex(&indexed);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,373 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list_set.h"
+
+typedef enum
+{
+    SET_UNION,
+    SET_INTERSECT,
+    SET_DIFFERENCE
+} SetOperation;
+
+/*
+ * discardNode - Frees a node dropped from a list, unless it lives in a
+ * slab (same rule as releaseNode in singly_linked_list.c)
+ */
+static void discardNode(struct Node *node)
+{
+    if (!node->inSlab)
+        free(node);
+}
+
+/*
+ * mergeValues - One merge pass of a and b, writing the result to values
+ *
+ * Returns: number of values written
+ */
+static int mergeValues(List *a, List *b, SetOperation operation, int *values)
+{
+    struct Node *x = a->head;
+    struct Node *y = b->head;
+    int count = 0;
+
+    while (x != NULL && y != NULL)
+    {
+        if (x->data < y->data)
+        {
+            if (operation != SET_INTERSECT)
+                values[count++] = x->data;
+            x = x->Next;
+        }
+        else if (y->data < x->data)
+        {
+            if (operation == SET_UNION)
+                values[count++] = y->data;
+            y = y->Next;
+        }
+        else
+        {
+            if (operation != SET_DIFFERENCE)
+                values[count++] = x->data;
+            x = x->Next;
+            y = y->Next;
+        }
+    }
+
+    // Whatever is left of a belongs to union and difference, of b to union
+    for (; x != NULL && operation != SET_INTERSECT; x = x->Next)
+        values[count++] = x->data;
+    for (; y != NULL && operation == SET_UNION; y = y->Next)
+        values[count++] = y->data;
+    return count;
+}
+
+/*
+ * setToNewList - Runs mergeValues into a scratch array and builds out from
+ * it with listFromArray
+ */
+static int setToNewList(List *a, List *b, SetOperation operation, List *out)
+{
+    int bound = a->size;
+    if (operation == SET_UNION)
+        bound += b->size;
+
+    int *values = (int *)malloc((bound + 1) * sizeof(int));
+    if (values == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        initList(out);
+        return -1;
+    }
+    int count = mergeValues(a, b, operation, values);
+    int result = listFromArray(out, values, count);
+    free(values);
+    return result;
+}
+
+/*
+ * listUnion - out = a ∪ b as a new list; a and b are left unchanged
+ * @out: handle to fill (any previous contents are not freed, as in
+ *       listFromArray)
+ *
+ * Returns: 0 on success, -1 if allocation failed (out is then empty)
+ *
+ * Time Complexity: O(m + n), one slab for the result
+ */
+int listUnion(List *a, List *b, List *out)
+{
+    return setToNewList(a, b, SET_UNION, out);
+}
+
+/*
+ * listIntersect - out = a ∩ b as a new list; see listUnion
+ */
+int listIntersect(List *a, List *b, List *out)
+{
+    return setToNewList(a, b, SET_INTERSECT, out);
+}
+
+/*
+ * listDifference - out = a \ b as a new list; see listUnion
+ */
+int listDifference(List *a, List *b, List *out)
+{
+    return setToNewList(a, b, SET_DIFFERENCE, out);
+}
+
+/*
+ * listUnionInPlace - a = a ∪ b, merging b's nodes into a
+ * @a: sorted list, receives the result
+ * @b: sorted list, left empty; its slabs move to a as in appendList
+ *
+ * Nodes of b equal to a node of a are freed; everything else is relinked.
+ * a's index, if any, is rebuilt.
+ *
+ * Time Complexity: O(m + n), no allocation
+ */
+void listUnionInPlace(List *a, List *b)
+{
+    if (a == b)
+        return;
+
+    struct Node *x = a->head;
+    struct Node *y = b->head;
+    struct Node *head = NULL, *last = NULL;
+    struct Node **link = &head;
+    int dropped = 0;
+
+    while (x != NULL && y != NULL)
+    {
+        struct Node *take;
+        if (y->data < x->data)
+        {
+            take = y;
+            y = y->Next;
+        }
+        else
+        {
+            if (x->data == y->data)
+            {
+                struct Node *duplicate = y;
+                y = y->Next;
+                discardNode(duplicate);
+                dropped++;
+            }
+            take = x;
+            x = x->Next;
+        }
+        *link = take;
+        link = &take->Next;
+        last = take;
+    }
+
+    // Splice whichever list has nodes left; its tail is the result's tail
+    if (x != NULL)
+    {
+        *link = x;
+        last = a->tail;
+    }
+    else if (y != NULL)
+    {
+        *link = y;
+        last = b->tail;
+    }
+    else
+        *link = NULL;
+
+    a->head = head;
+    a->tail = last;
+    a->size += b->size - dropped;
+
+    if (b->slabs != NULL)
+    {
+        struct NodeSlab *slab = b->slabs;
+        while (slab->next != NULL)
+            slab = slab->next;
+        slab->next = a->slabs;
+        a->slabs = b->slabs;
+    }
+    disableListIndex(b);
+    initList(b);
+    rebuildListIndex(a);
+}
+
+/*
+ * filterInPlace - Keeps the nodes of a that are (keepMatched = 1) or are
+ * not (keepMatched = 0) matched by a node of b; frees the rest
+ */
+static void filterInPlace(List *a, List *b, int keepMatched)
+{
+    struct Node *x = a->head;
+    struct Node *y = b->head;
+    struct Node *head = NULL, *last = NULL;
+    struct Node **link = &head;
+    int size = 0;
+
+    while (x != NULL)
+    {
+        while (y != NULL && y->data < x->data)
+            y = y->Next;
+
+        int matched = (y != NULL && y->data == x->data);
+        if (matched)
+            y = y->Next;                    // one node of b matches one node of a
+
+        struct Node *next = x->Next;
+        if (matched == keepMatched)
+        {
+            *link = x;
+            link = &x->Next;
+            last = x;
+            size++;
+        }
+        else
+            discardNode(x);
+        x = next;
+    }
+    *link = NULL;
+
+    a->head = head;
+    a->tail = last;
+    a->size = size;
+    rebuildListIndex(a);
+}
+
+/*
+ * listIntersectInPlace - a = a ∩ b, freeing a's unmatched nodes
+ * @a: sorted list, receives the result
+ * @b: sorted list, left unchanged
+ *
+ * Time Complexity: O(m + n), no allocation
+ */
+void listIntersectInPlace(List *a, List *b)
+{
+    if (a == b)
+        return;
+    filterInPlace(a, b, 1);
+}
+
+/*
+ * listDifferenceInPlace - a = a \ b, freeing a's matched nodes
+ * @a: sorted list, receives the result
+ * @b: sorted list, left unchanged
+ *
+ * Time Complexity: O(m + n), no allocation
+ */
+void listDifferenceInPlace(List *a, List *b)
+{
+    if (a == b)
+    {
+        freeList(a);
+        return;
+    }
+    filterInPlace(a, b, 0);
+}
+
+/*
+ * gallop - Finger search: first node >= value, starting from the previous
+ * search's path instead of the head
+ * @finger: finger[level] = last node on that level known to be < value
+ *          (all the head to begin with); updated for the next call
+ *
+ * Climbs while a higher level can still move right, then descends as in
+ * skipLowerBound. A gap of d nodes costs O(log d) expected, so values
+ * must come in ascending order.
+ */
+static struct SkipNode *gallop(SkipList *list, struct SkipNode **finger, int value)
+{
+    int level = 0;
+    while (level + 1 < list->level)
+    {
+        struct SkipNode *next = finger[level + 1]->Next[level + 1];
+        if (next == NULL || next->data >= value)
+            break;
+        level++;
+    }
+
+    struct SkipNode *curr = finger[level];
+    for (; level >= 0; level--)
+    {
+        while (curr->Next[level] != NULL && curr->Next[level]->data < value)
+            curr = curr->Next[level];
+        finger[level] = curr;
+    }
+    return curr->Next[0];
+}
+
+/*
+ * matchAgainstSkip - Shared body of skipIntersectList / skipDifferenceList
+ *
+ * For each run of k equal values in small, finds the value's lower bound
+ * in large (gallop, or a base-level walk when the sizes are close), counts
+ * up to k equal nodes there, and keeps min(k, j) or k - min(k, j) copies.
+ */
+static int matchAgainstSkip(SkipList *large, List *small, int keepMatched, List *out)
+{
+    int *values = (int *)malloc((small->size + 1) * sizeof(int));
+    if (values == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        initList(out);
+        return -1;
+    }
+
+    struct SkipNode *finger[SKIP_MAX_LEVEL];
+    for (int level = 0; level < SKIP_MAX_LEVEL; level++)
+        finger[level] = large->head;
+    int galloping = (long long)small->size * LIST_GALLOP_RATIO < large->size;
+    struct SkipNode *node = large->head->Next[0];
+    int count = 0;
+
+    for (struct Node *x = small->head; x != NULL;)
+    {
+        int value = x->data;
+        int run = 0;
+        for (; x != NULL && x->data == value; x = x->Next)
+            run++;
+
+        if (galloping)
+            node = gallop(large, finger, value);
+        else
+        {
+            while (node != NULL && node->data < value)
+                node = node->Next[0];
+        }
+
+        int matched = 0;
+        for (; node != NULL && node->data == value && matched < run; node = node->Next[0])
+            matched++;
+
+        int keep = keepMatched ? matched : run - matched;
+        for (int i = 0; i < keep; i++)
+            values[count++] = value;
+    }
+
+    int result = listFromArray(out, values, count);
+    free(values);
+    return result;
+}
+
+/*
+ * skipIntersectList - out = small ∩ large as a new list
+ * @large: skip list (e.g. skipFromList of a big sorted List, built once)
+ * @small: sorted list
+ * @out: handle to fill (previous contents are not freed)
+ *
+ * Returns: 0 on success, -1 if allocation failed (out is then empty)
+ *
+ * Time Complexity: O(m log(n / m)) expected when galloping,
+ *                  O(m + n) when large is within LIST_GALLOP_RATIO of small
+ */
+int skipIntersectList(SkipList *large, List *small, List *out)
+{
+    return matchAgainstSkip(large, small, 1, out);
+}
+
+/*
+ * skipDifferenceList - out = small \ large as a new list; see
+ * skipIntersectList
+ */
+int skipDifferenceList(List *small, SkipList *large, List *out)
+{
+    return matchAgainstSkip(large, small, 0, out);
+}
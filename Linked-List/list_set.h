@@ -0,0 +1,52 @@
+#ifndef LIST_SET_H
+#define LIST_SET_H
+
+#include "singly_linked_list.h"
+#include "skip_list.h"
+
+/*
+ * ============================================================================
+ * SET OPERATIONS ON SORTED LISTS
+ * ============================================================================
+ *
+ * Union / intersection / difference of two ascending Lists (insertSorted,
+ * sortList, ...) in one merge pass, O(m + n), instead of a search of one
+ * list per element of the other, O(m * n):
+ *
+ *   a: 1 -> 3 -> 5 -> 7          union:      1 3 4 5 7
+ *   b: 3 -> 4 -> 5               intersect:  3 5
+ *                                difference: 1 7        (a minus b)
+ *
+ * Duplicates follow the multiset rule of std::set_union and friends: a
+ * value held x times by a and y times by b appears max(x, y), min(x, y)
+ * and max(x - y, 0) times.
+ *
+ *   listUnion(a, b, out)      new list in out, built as one slab
+ *   listUnionInPlace(a, b)    a becomes the result by relinking nodes;
+ *                             no node is allocated, dropped ones are freed
+ *
+ * A List has no skip pointers: getting to the k-th node takes k hops
+ * however few comparisons are made, so a merge is already as fast as any
+ * walk. When one side is much larger and already a SkipList, its towers
+ * are the skip pointers: skipIntersectList / skipDifferenceList gallop
+ * from one lower bound to the next (finger search, O(log d) for a gap of
+ * d nodes), so a small list is matched in O(m log(n / m)) instead of
+ * O(n). They fall back to a base-level merge when the sizes are within
+ * LIST_GALLOP_RATIO of each other.
+ * ============================================================================
+ */
+
+#define LIST_GALLOP_RATIO 128       // gallop when large->size > ratio * small->size
+
+int listUnion(List *a, List *b, List *out);
+int listIntersect(List *a, List *b, List *out);
+int listDifference(List *a, List *b, List *out);
+
+void listUnionInPlace(List *a, List *b);
+void listIntersectInPlace(List *a, List *b);
+void listDifferenceInPlace(List *a, List *b);
+
+int skipIntersectList(SkipList *large, List *small, List *out);
+int skipDifferenceList(List *small, SkipList *large, List *out);
+
+#endif
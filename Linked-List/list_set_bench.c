@@ -0,0 +1,268 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "singly_linked_list.h"
+#include "skip_list.h"
+#include "list_set.h"
+
+/*
+ * Test driver / benchmark for list_set.c
+ *
+ * 1. Random sorted lists with duplicates (heap nodes from insertSorted or
+ *    one slab from listFromArray, sometimes indexed): every operation,
+ *    new-list and in-place, plus the skip list versions in both the merge
+ *    and the galloping regime, checked against per-value counts
+ * 2. Intersection of two equal lists: search() per element (the nested
+ *    loop) vs listIntersect
+ * 3. Skewed intersection: a small list against a large one, merge vs
+ *    skipIntersectList (after a one-off skipFromList)
+ *
+ * Build: gcc -O2 singly_linked_list.c skip_list.c list_set.c list_set_bench.c -o listset
+ * Usage: ./listset [largeSize] [smallSize]
+ */
+
+#define VALUE_RANGE 64
+
+static unsigned int state = 4242;
+
+static int randomInt(int bound)
+{
+    state = state * 1103515245u + 12345u;
+    return (int)((state >> 8) % (unsigned int)bound);
+}
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * buildSorted - Sorted list from counts[], as heap nodes or as one slab
+ */
+static void buildSorted(List *list, const int *counts, int slab)
+{
+    int values[VALUE_RANGE * 16];
+    int n = 0;
+    for (int v = 0; v < VALUE_RANGE; v++)
+    {
+        for (int i = 0; i < counts[v]; i++)
+            values[n++] = v;
+    }
+    if (slab)
+        listFromArray(list, values, n);
+    else
+    {
+        initList(list);
+        for (int i = n - 1; i >= 0; i--)
+            insertSorted(list, values[i]);
+    }
+}
+
+/*
+ * matches - 1 if list is exactly counts[] in ascending order, with a
+ * correct size and tail
+ */
+static int matches(List *list, const int *counts)
+{
+    struct Node *curr = list->head;
+    int size = 0;
+    for (int v = 0; v < VALUE_RANGE; v++)
+    {
+        for (int i = 0; i < counts[v]; i++, size++)
+        {
+            if (curr == NULL || curr->data != v)
+                return 0;
+            if (curr->Next == NULL && curr != list->tail)
+                return 0;
+            curr = curr->Next;
+        }
+    }
+    return curr == NULL && getLength(list) == size && (size > 0 || list->tail == NULL);
+}
+
+static int randomCheck(int rounds)
+{
+    int a[VALUE_RANGE], b[VALUE_RANGE];
+    int unionCount[VALUE_RANGE], intersectCount[VALUE_RANGE], differenceCount[VALUE_RANGE];
+
+    for (int round = 0; round < rounds; round++)
+    {
+        // Sizes from empty to skewed; densityA == 4 leaves a with a value
+        // or two, so a dense b is past LIST_GALLOP_RATIO and skip*List
+        // gallops
+        int densityA = randomInt(5), densityB = randomInt(9);
+        for (int v = 0; v < VALUE_RANGE; v++)
+        {
+            if (densityA == 4)
+                a[v] = randomInt(VALUE_RANGE) == 0 ? 1 + randomInt(2) : 0;
+            else
+                a[v] = randomInt(4) < densityA ? randomInt(3) : 0;
+            b[v] = randomInt(8) < densityB ? 1 + randomInt(densityB + 1) : 0;
+            unionCount[v] = a[v] > b[v] ? a[v] : b[v];
+            intersectCount[v] = a[v] < b[v] ? a[v] : b[v];
+            differenceCount[v] = a[v] > b[v] ? a[v] - b[v] : 0;
+        }
+
+        List la, lb, out;
+        buildSorted(&la, a, randomInt(2));
+        buildSorted(&lb, b, randomInt(2));
+        int ok = 1;
+
+        listUnion(&la, &lb, &out);
+        ok = ok && matches(&out, unionCount);
+        freeList(&out);
+        listIntersect(&la, &lb, &out);
+        ok = ok && matches(&out, intersectCount);
+        freeList(&out);
+        listDifference(&la, &lb, &out);
+        ok = ok && matches(&out, differenceCount);
+        freeList(&out);
+
+        SkipList *skip = skipFromList(&lb, round);
+        skipIntersectList(skip, &la, &out);
+        ok = ok && matches(&out, intersectCount);
+        freeList(&out);
+        skipDifferenceList(&la, skip, &out);
+        ok = ok && matches(&out, differenceCount);
+        freeList(&out);
+        freeSkipList(skip);
+
+        // In place: work on copies so every operation sees the originals
+        int *expected[] = {unionCount, intersectCount, differenceCount};
+        for (int operation = 0; operation < 3; operation++)
+        {
+            List target, other;
+            buildSorted(&target, a, randomInt(2));
+            buildSorted(&other, b, randomInt(2));
+            int indexed = randomInt(2);
+            if (indexed)
+                enableListIndex(&target);
+
+            if (operation == 0)
+                listUnionInPlace(&target, &other);
+            else if (operation == 1)
+                listIntersectInPlace(&target, &other);
+            else
+                listDifferenceInPlace(&target, &other);
+
+            ok = ok && matches(&target, expected[operation]);
+            ok = ok && (operation != 0 || (other.head == NULL && getLength(&other) == 0));
+            for (int v = 0; indexed && v < VALUE_RANGE; v++)
+                ok = ok && listContains(&target, v) == (expected[operation][v] > 0);
+            disableListIndex(&target);
+            freeList(&target);
+            freeList(&other);
+        }
+
+        freeList(&la);
+        freeList(&lb);
+        if (!ok)
+        {
+            printf("Mismatch in round %d\n", round);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    int largeSize = (argc > 1) ? atoi(argv[1]) : 4000000;
+    int smallSize = (argc > 2) ? atoi(argv[2]) : 1000;
+
+    // ---- Demo ----
+    List a, b, out;
+    int left[] = {1, 3, 5, 7}, right[] = {3, 4, 5};
+    listFromArray(&a, left, 4);
+    listFromArray(&b, right, 3);
+    listUnion(&a, &b, &out);
+    printf("Union:        ");
+    printList(&out);                    // 1 3 4 5 7
+    freeList(&out);
+    listIntersect(&a, &b, &out);
+    printf("Intersection: ");
+    printList(&out);                    // 3 5
+    freeList(&out);
+    listDifferenceInPlace(&a, &b);
+    printf("a minus b:    ");
+    printList(&a);                      // 1 7
+    freeList(&a);
+    freeList(&b);
+
+    int ok = randomCheck(3000);
+    printf("\nRandom check (3000 rounds, all operations): %s\n", ok ? "OK" : "FAILED");
+
+    // ---- Nested loop vs merge, equal sizes ----
+    int equalSize = 20000;
+    int *values = (int *)malloc((size_t)largeSize * sizeof(int));
+    if (values == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+    for (int i = 0; i < equalSize; i++)
+        values[i] = 2 * i;
+    listFromArray(&a, values, equalSize);
+    for (int i = 0; i < equalSize; i++)
+        values[i] = 3 * i;
+    listFromArray(&b, values, equalSize);
+
+    double start = nowSeconds();
+    int found = 0;
+    for (struct Node *x = a.head; x != NULL; x = x->Next)
+        found += search(&b, x->data) >= 0;
+    double nested = nowSeconds() - start;
+
+    start = nowSeconds();
+    listIntersect(&a, &b, &out);
+    double merged = nowSeconds() - start;
+    ok = ok && getLength(&out) == found;
+    printf("\n%d x %d intersection: search per element %.3f s, listIntersect %.6f s (%d common)\n",
+           equalSize, equalSize, nested, merged, found);
+    freeList(&out);
+    freeList(&a);
+    freeList(&b);
+
+    // ---- Skewed: small vs large ----
+    // large: even numbers; small: spread over the same range, every
+    // other one odd (a miss)
+    List large, small;
+    initList(&large);
+    for (int i = 0; i < largeSize; i++)
+        insertAtEnd(&large, 2 * i);
+    int step = largeSize / smallSize > 0 ? largeSize / smallSize : 1;
+    initList(&small);
+    for (int i = 0; i < smallSize; i++)
+        insertAtEnd(&small, 2 * i * step + (i & 1));
+
+    start = nowSeconds();
+    listIntersect(&small, &large, &out);
+    double mergeSeconds = nowSeconds() - start;
+    int mergeCount = getLength(&out);
+    freeList(&out);
+
+    start = nowSeconds();
+    SkipList *skip = skipFromList(&large, 7);
+    double buildSeconds = nowSeconds() - start;
+
+    start = nowSeconds();
+    skipIntersectList(skip, &small, &out);
+    double gallopSeconds = nowSeconds() - start;
+    ok = ok && getLength(&out) == mergeCount && (mergeCount == (smallSize + 1) / 2 || step == 1);
+    freeList(&out);
+
+    printf("\n%d vs %d intersection (%d common):\n", smallSize, largeSize, mergeCount);
+    printf("  listIntersect (merge)        %9.6f s\n", mergeSeconds);
+    printf("  skipIntersectList (gallop)   %9.6f s   %.0fx, after a one-off skipFromList of %.3f s\n",
+           gallopSeconds, mergeSeconds / gallopSeconds, buildSeconds);
+
+    freeSkipList(skip);
+    freeList(&large);
+    freeList(&small);
+    free(values);
+
+    printf("\n%s\n", ok ? "All checks OK" : "CHECK FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,213 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list_sort.h"
+#include "../Graph/parallel.h"
+
+/*
+ * mergeRuns - Merges two sorted NULL-terminated chains
+ * @a, @aTail: the earlier run and its last node (wins ties, so the sort
+ *             is stable)
+ * @b, @bTail: the later run and its last node
+ * @tail: out, last node of the result
+ *
+ * The result's last node is whichever tail holds the larger value (b's on
+ * a tie), so the leftover run is hooked on without walking it.
+ *
+ * Returns: head of the merged chain
+ */
+static struct Node *mergeRuns(struct Node *a, struct Node *aTail,
+                              struct Node *b, struct Node *bTail, struct Node **tail)
+{
+    if (a == NULL)
+    {
+        *tail = bTail;
+        return b;
+    }
+    if (b == NULL)
+    {
+        *tail = aTail;
+        return a;
+    }
+    *tail = (bTail->data >= aTail->data) ? bTail : aTail;
+
+    struct Node dummy;
+    struct Node *last = &dummy;
+    while (a != NULL && b != NULL)
+    {
+        if (b->data < a->data)
+        {
+            last->Next = b;
+            last = b;
+            b = b->Next;
+        }
+        else
+        {
+            last->Next = a;
+            last = a;
+            a = a->Next;
+        }
+    }
+    last->Next = (a != NULL) ? a : b;
+    return dummy.Next;
+}
+
+/*
+ * sortChain - Bottom-up merge sort of a NULL-terminated chain
+ *
+ * Returns: head of the sorted chain; *tail gets its last node
+ */
+static struct Node *sortChain(struct Node *head, struct Node **tail)
+{
+    struct Node *bins[LIST_SORT_BINS] = {NULL};
+    struct Node *binTails[LIST_SORT_BINS];
+    int used = 0;
+
+    while (head != NULL)
+    {
+        struct Node *carry = head;
+        struct Node *carryTail = head;
+        head = head->Next;
+        carry->Next = NULL;
+
+        // bins[k] is older than carry, so it goes first
+        int k = 0;
+        for (; k < LIST_SORT_BINS - 1 && bins[k] != NULL; k++)
+        {
+            carry = mergeRuns(bins[k], binTails[k], carry, carryTail, &carryTail);
+            bins[k] = NULL;
+        }
+        bins[k] = carry;
+        binTails[k] = carryTail;
+        if (k + 1 > used)
+            used = k + 1;
+    }
+
+    // Fold the leftover runs, smallest (newest) first
+    struct Node *result = NULL;
+    *tail = NULL;
+    for (int k = 0; k < used; k++)
+    {
+        if (bins[k] != NULL)
+            result = mergeRuns(bins[k], binTails[k], result, *tail, tail);
+    }
+    return result;
+}
+
+/*
+ * sortList - Sorts the list ascending by relinking nodes
+ *
+ * A list index (enableListIndex), if any, is rebuilt afterwards.
+ *
+ * Time Complexity: O(n log n)
+ * Space Complexity: O(1) (LIST_SORT_BINS pointers)
+ */
+void sortList(List *list)
+{
+    if (list->size < 2)
+        return;
+    list->head = sortChain(list->head, &list->tail);
+    rebuildListIndex(list);
+}
+
+typedef struct SortContext
+{
+    struct Node **heads;        // one chain per chunk
+    struct Node **tails;
+    int stride;                 // merge round: chunk i absorbs chunk i + stride
+    int chunks;
+} SortContext;
+
+static void sortWorker(void *arg, int thread, int threads)
+{
+    (void)threads;
+    SortContext *context = (SortContext *)arg;
+    context->heads[thread] = sortChain(context->heads[thread], &context->tails[thread]);
+}
+
+static void mergeWorker(void *arg, int thread, int threads)
+{
+    (void)threads;
+    SortContext *context = (SortContext *)arg;
+    int i = thread * 2 * context->stride;
+    int j = i + context->stride;
+    if (j >= context->chunks)
+        return;
+    context->heads[i] = mergeRuns(context->heads[i], context->tails[i],
+                                  context->heads[j], context->tails[j], &context->tails[i]);
+}
+
+/*
+ * parallelSortList - sortList on `threads` threads
+ *
+ * The cut itself is one sequential walk (a list has no random access);
+ * after that every chunk sorts independently. The last merge round is a
+ * single sequential pass over all n nodes, which bounds the speedup.
+ *
+ * Time Complexity: O(n log(n / threads) / threads + n log threads)
+ */
+void parallelSortList(List *list, int threads)
+{
+    if (threads < 1)
+        threads = 1;
+    if (list->size < 2 * threads || threads == 1)
+    {
+        sortList(list);
+        return;
+    }
+
+    SortContext context;
+    context.heads = (struct Node **)malloc(threads * sizeof(struct Node *));
+    context.tails = (struct Node **)malloc(threads * sizeof(struct Node *));
+    if (context.heads == NULL || context.tails == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(context.heads);
+        free(context.tails);
+        sortList(list);
+        return;
+    }
+    context.chunks = threads;
+
+    // Cut into `threads` NULL-terminated chains of nearly equal length
+    struct Node *curr = list->head;
+    for (int t = 0; t < threads; t++)
+    {
+        long long first, last;
+        threadRange(list->size, t, threads, &first, &last);
+        context.heads[t] = curr;
+        for (long long i = first; i < last - 1; i++)
+            curr = curr->Next;
+        struct Node *next = curr->Next;
+        curr->Next = NULL;
+        curr = next;
+    }
+
+    parallelRun(threads, sortWorker, &context);
+
+    for (context.stride = 1; context.stride < threads; context.stride *= 2)
+    {
+        int merges = (threads + 2 * context.stride - 1) / (2 * context.stride);
+        parallelRun(merges, mergeWorker, &context);
+    }
+
+    list->head = context.heads[0];
+    list->tail = context.tails[0];
+    free(context.heads);
+    free(context.tails);
+    rebuildListIndex(list);
+}
+
+/*
+ * isSortedList - 1 if the list is in ascending order
+ *
+ * Time Complexity: O(n)
+ */
+int isSortedList(List *list)
+{
+    for (struct Node *curr = list->head; curr != NULL && curr->Next != NULL; curr = curr->Next)
+    {
+        if (curr->Next->data < curr->data)
+            return 0;
+    }
+    return 1;
+}
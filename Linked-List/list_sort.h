@@ -0,0 +1,40 @@
+#ifndef LIST_SORT_H
+#define LIST_SORT_H
+
+#include "singly_linked_list.h"
+
+/*
+ * ============================================================================
+ * IN-PLACE LINKED LIST SORTING
+ * ============================================================================
+ *
+ * Sorts a List by relinking its nodes; no array copy, no node allocation.
+ *
+ * sortList - bottom-up merge sort. Nodes are taken off the front one by
+ * one and carried up a stack of bins, bins[k] holding a sorted run of
+ * exactly 2^k nodes (the binary counter trick also used by the Linux
+ * kernel's list_sort):
+ *
+ *   push 1 node:   carry = [x]
+ *                  bins[0] full?  carry = merge(bins[0], carry), bins[0] = empty
+ *                  bins[1] full?  carry = merge(bins[1], carry), ...
+ *                  first empty bin <- carry
+ *
+ * Every merge joins two runs of equal size, exactly like the classic
+ * "width = 1, 2, 4, ..." passes, but merges happen while the runs are
+ * still in cache instead of once per full pass over the list. Extra
+ * space: 32 bin pointers, whatever n is. Stable.
+ *
+ * parallelSortList - cuts the list into one chunk per thread, sorts the
+ * chunks with sortList concurrently, then merges them pairwise, each round
+ * of merges also in parallel.
+ * ============================================================================
+ */
+
+#define LIST_SORT_BINS 32           // 2^31 nodes > INT_MAX list size
+
+void sortList(List *list);
+void parallelSortList(List *list, int threads);
+int isSortedList(List *list);
+
+#endif
@@ -0,0 +1,199 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "list_sort.h"
+#include "../Graph/parallel.h"
+
+/*
+ * Test driver / benchmark for list_sort.c
+ *
+ * For each size: build a List of random values (nodes allocated in list
+ * order), then time
+ *   - copy to an array + qsort + copy back (the old way, 2x peak memory)
+ *   - sortList
+ *   - parallelSortList
+ * each on a freshly built copy of the same input, and check order, length,
+ * tail and checksum. Finally a sorted list whose nodes are scattered in
+ * memory (the output of the previous sort) is sorted again.
+ *
+ * Build: gcc -O2 -pthread ../Graph/parallel.c singly_linked_list.c list_sort.c list_sort_bench.c -o listsort
+ * Usage: ./listsort [maxNodes] [threads]       sizes 1M, 10M, 100M up to maxNodes
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int compareInts(const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * buildList - Links nodes[0 .. n-1] in allocation order and fills them
+ * with the same pseudo-random values for a given seed
+ *
+ * Reusing the nodes (instead of free + malloc) keeps every timed run on
+ * the same memory layout: freeing a sorted list would hand its scattered
+ * addresses straight back to the next build.
+ *
+ * Returns: checksum of the values
+ */
+static long long buildList(List *list, struct Node **nodes, int n, unsigned int seed)
+{
+    long long checksum = 0;
+    initList(list);
+    for (int i = 0; i < n; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        nodes[i]->data = (int)(seed >> 1);
+        nodes[i]->Next = (i + 1 < n) ? nodes[i + 1] : NULL;
+        checksum += nodes[i]->data;
+    }
+    if (n > 0)
+    {
+        list->head = nodes[0];
+        list->tail = nodes[n - 1];
+        list->size = n;
+    }
+    return checksum;
+}
+
+static struct Node **createNodes(int n)
+{
+    struct Node **nodes = (struct Node **)malloc(((size_t)n + 1) * sizeof(struct Node *));
+    if (nodes == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (int i = 0; i < n; i++)
+        nodes[i] = CreateNode(0);
+    return nodes;
+}
+
+static void freeNodes(struct Node **nodes, int n)
+{
+    for (int i = 0; i < n; i++)
+        free(nodes[i]);
+    free(nodes);
+}
+
+static int verify(List *list, int n, long long checksum)
+{
+    long long sum = 0;
+    int count = 0;
+    struct Node *last = NULL;
+    for (struct Node *curr = list->head; curr != NULL; curr = curr->Next)
+    {
+        sum += curr->data;
+        count++;
+        last = curr;
+    }
+    return count == n && getLength(list) == n && last == list->tail &&
+           sum == checksum && isSortedList(list);
+}
+
+static int runSize(int n, int threads)
+{
+    List list;
+    struct Node **nodes = createNodes(n);
+    printf("\n%d nodes\n", n);
+    int ok = 1;
+
+    // Array + qsort: values move, links stay
+    long long checksum = buildList(&list, nodes, n, 1);
+    double start = nowSeconds();
+    int *values = (int *)malloc((size_t)n * sizeof(int));
+    if (values == NULL)
+    {
+        printf("  array + qsort     : Memory allocation failed!\n");
+    }
+    else
+    {
+        int i = 0;
+        for (struct Node *curr = list.head; curr != NULL; curr = curr->Next)
+            values[i++] = curr->data;
+        qsort(values, n, sizeof(int), compareInts);
+        i = 0;
+        for (struct Node *curr = list.head; curr != NULL; curr = curr->Next)
+            curr->data = values[i++];
+        free(values);
+        double seconds = nowSeconds() - start;
+        ok = verify(&list, n, checksum);
+        printf("  array + qsort     : %8.3f s   (+%lld MB)\n", seconds, (long long)n * sizeof(int) >> 20);
+    }
+
+    checksum = buildList(&list, nodes, n, 1);
+    start = nowSeconds();
+    sortList(&list);
+    double sequential = nowSeconds() - start;
+    ok = verify(&list, n, checksum) && ok;
+    printf("  sortList          : %8.3f s   (+0 MB)\n", sequential);
+
+    for (int t = 2; t <= threads; t *= 2)
+    {
+        checksum = buildList(&list, nodes, n, 1);
+        start = nowSeconds();
+        parallelSortList(&list, t);
+        double seconds = nowSeconds() - start;
+        ok = verify(&list, n, checksum) && ok;
+        printf("  parallel, %2d thr  : %8.3f s   (%.2fx)\n", t, seconds, sequential / seconds);
+    }
+
+    // Already sorted, but every link now jumps somewhere random in memory
+    start = nowSeconds();
+    sortList(&list);
+    printf("  sorted, scattered : %8.3f s\n", nowSeconds() - start);
+    ok = verify(&list, n, checksum) && ok;
+
+    printf("  %s\n", ok ? "OK" : "MISMATCH");
+    freeNodes(nodes, n);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    int maxNodes = (argc > 1) ? atoi(argv[1]) : 10000000;
+    int threads = (argc > 2) ? atoi(argv[2]) : defaultThreadCount();
+
+    // ---- Demo ----
+    List demo;
+    initList(&demo);
+    int input[] = {30, 10, 50, 20, 40, 10};
+    for (int i = 0; i < 6; i++)
+        insertAtEnd(&demo, input[i]);
+    printf("Before: ");
+    printList(&demo);
+    sortList(&demo);
+    printf("After:  ");
+    printList(&demo);
+    printf("Tail: %d, sorted: %d\n", demo.tail->data, isSortedList(&demo));
+    while (getLength(&demo) > 0)
+        deleteFromBeginning(&demo);
+
+    // Small sizes, including ones not divisible by the thread count
+    int ok = 1;
+    for (int n = 0; n < 200 && ok; n++)
+    {
+        List list;
+        struct Node **nodes = createNodes(n);
+        long long checksum = buildList(&list, nodes, n, n + 1);
+        parallelSortList(&list, 1 + n % 7);
+        ok = verify(&list, n, checksum);
+        freeNodes(nodes, n);
+    }
+    printf("Sizes 0..199, 1..7 threads: %s\n", ok ? "OK" : "MISMATCH");
+    if (threads < 4)
+        threads = 4;        // still shows the chunked path on small machines
+
+    for (long long n = 1000000; n <= maxNodes; n *= 10)
+        ok = runSize((int)n, threads) && ok;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,235 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <sched.h>
+#include <pthread.h>
+#include <time.h>
+#include "singly_linked_list.h"
+#include "lock_free_stack.h"
+#include "lock_free_queue.h"
+#include "../Graph/parallel.h"
+
+/*
+ * Multi-producer / multi-consumer benchmark for lock_free_stack.c and
+ * lock_free_queue.c against a mutex around the singly List
+ *
+ * Half the threads produce `items` values each, encoded as
+ * producer * items + sequence; the other half consume until everything
+ * has been taken. Checks:
+ *   - every value comes out exactly once (count + sum)
+ *   - queues only: each consumer sees every producer's values in order
+ *
+ * Build: gcc -O2 -pthread ../Graph/parallel.c singly_linked_list.c lock_free_stack.c lock_free_queue.c lock_free_bench.c -o lockfree
+ * Usage: ./lockfree [itemsPerProducer] [maxThreads]
+ */
+
+typedef enum
+{
+    MUTEX_STACK,
+    MUTEX_QUEUE,
+    TREIBER_STACK,
+    MS_QUEUE
+} Container;
+
+static const char *containerNames[] = {"mutex + List stack", "mutex + List queue",
+                                       "Treiber stack", "Michael-Scott queue"};
+
+typedef struct BenchContext
+{
+    Container kind;
+    List list;
+    pthread_mutex_t lock;
+    TreiberStack *stack;
+    MSQueue *queue;
+    int producers;
+    int items;                  // per producer
+    long long consumed;         // shared count, atomic
+    long long sum;              // of consumed values, atomic
+    int orderErrors;            // atomic
+} BenchContext;
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void put(BenchContext *context, int thread, int value)
+{
+    switch (context->kind)
+    {
+    case MUTEX_STACK:
+        pthread_mutex_lock(&context->lock);
+        insertAtBeginning(&context->list, value);
+        pthread_mutex_unlock(&context->lock);
+        break;
+    case MUTEX_QUEUE:
+        pthread_mutex_lock(&context->lock);
+        insertAtEnd(&context->list, value);
+        pthread_mutex_unlock(&context->lock);
+        break;
+    case TREIBER_STACK:
+        if (treiberPush(context->stack, value) != 0)
+            exit(1);
+        break;
+    case MS_QUEUE:
+        msqEnqueue(context->queue, thread, value);
+        break;
+    }
+}
+
+static int take(BenchContext *context, int thread, int *value)
+{
+    int got = 0;
+    switch (context->kind)
+    {
+    case MUTEX_STACK:
+    case MUTEX_QUEUE:
+        pthread_mutex_lock(&context->lock);
+        if (getLength(&context->list) > 0)
+        {
+            *value = deleteFromBeginning(&context->list);
+            got = 1;
+        }
+        pthread_mutex_unlock(&context->lock);
+        break;
+    case TREIBER_STACK:
+        got = treiberPop(context->stack, value);
+        break;
+    case MS_QUEUE:
+        got = msqDequeue(context->queue, thread, value);
+        break;
+    }
+    return got;
+}
+
+static void benchWorker(void *arg, int thread, int threads)
+{
+    BenchContext *context = (BenchContext *)arg;
+
+    if (thread < context->producers)
+    {
+        int base = thread * context->items;
+        for (int i = 0; i < context->items; i++)
+            put(context, thread, base + i);
+        return;
+    }
+
+    long long total = (long long)context->producers * context->items;
+    int *lastSeen = (int *)malloc(context->producers * sizeof(int));
+    if (lastSeen == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    for (int p = 0; p < context->producers; p++)
+        lastSeen[p] = -1;
+
+    int fifo = context->kind == MUTEX_QUEUE || context->kind == MS_QUEUE;
+    long long sum = 0, taken = 0;
+    int errors = 0, value;
+    (void)threads;
+
+    while (__atomic_load_n(&context->consumed, __ATOMIC_RELAXED) < total)
+    {
+        if (!take(context, thread, &value))
+        {
+            // Empty: publish what this thread holds back, let a producer run
+            __atomic_fetch_add(&context->consumed, taken, __ATOMIC_RELAXED);
+            taken = 0;
+            sched_yield();
+            continue;
+        }
+        sum += value;
+        taken++;
+        int producer = value / context->items;
+        int sequence = value % context->items;
+        if (fifo && sequence <= lastSeen[producer])
+            errors++;
+        lastSeen[producer] = sequence;
+        if ((taken & 255) == 0)
+        {
+            __atomic_fetch_add(&context->consumed, 256, __ATOMIC_RELAXED);
+            taken = 0;
+        }
+    }
+    __atomic_fetch_add(&context->consumed, taken, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&context->sum, sum, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&context->orderErrors, errors, __ATOMIC_RELAXED);
+    free(lastSeen);
+}
+
+static int runBench(Container kind, int threads, int items)
+{
+    BenchContext context;
+    context.kind = kind;
+    initList(&context.list);
+    pthread_mutex_init(&context.lock, NULL);
+    context.stack = (kind == TREIBER_STACK) ? createTreiberStack() : NULL;
+    context.queue = (kind == MS_QUEUE) ? createMSQueue(threads) : NULL;
+    context.producers = threads / 2;
+    context.items = items;
+    context.consumed = 0;
+    context.sum = 0;
+    context.orderErrors = 0;
+
+    double start = nowSeconds();
+    parallelRun(threads, benchWorker, &context);
+    double seconds = nowSeconds() - start;
+
+    long long total = (long long)context.producers * items;
+    long long expectedSum = total * (total - 1) / 2;
+    int leftover = 0;
+    for (int value; take(&context, 0, &value);)
+        leftover++;
+    int ok = context.consumed == total && context.sum == expectedSum &&
+             context.orderErrors == 0 && leftover == 0;
+
+    printf("  %-20s %2d thr: %8.2f M ops/s  %s\n", containerNames[kind], threads,
+           2.0 * total / seconds / 1e6, ok ? "OK" : "MISMATCH");
+
+    while (getLength(&context.list) > 0)
+        deleteFromBeginning(&context.list);
+    pthread_mutex_destroy(&context.lock);
+    freeTreiberStack(context.stack);
+    freeMSQueue(context.queue);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    int items = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int maxThreads = (argc > 2) ? atoi(argv[2]) : defaultThreadCount();
+    if (maxThreads < 4)
+        maxThreads = 4;     // oversubscribed on small machines, still exercises the races
+
+    // ---- Demo ----
+    TreiberStack *stack = createTreiberStack();
+    MSQueue *queue = createMSQueue(1);
+    for (int value = 10; value <= 30; value += 10)
+    {
+        treiberPush(stack, value);
+        msqEnqueue(queue, 0, value);
+    }
+    int value;
+    printf("Stack pops:");
+    while (treiberPop(stack, &value))
+        printf(" %d", value);           // 30 20 10
+    printf("\nQueue dequeues:");
+    while (msqDequeue(queue, 0, &value))
+        printf(" %d", value);           // 10 20 30
+    printf("\n");
+    freeTreiberStack(stack);
+    freeMSQueue(queue);
+
+    int ok = 1;
+    printf("\n%d items per producer, half the threads produce, half consume\n", items);
+    for (int threads = 2; threads <= maxThreads; threads *= 2)
+    {
+        for (int kind = MUTEX_STACK; kind <= MS_QUEUE; kind++)
+            ok = runBench((Container)kind, threads, items) && ok;
+    }
+
+    printf("\n%s\n", ok ? "All checks OK" : "CHECK FAILED");
+    return ok ? 0 : 1;
+}
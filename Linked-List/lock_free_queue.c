@@ -0,0 +1,247 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "lock_free_queue.h"
+
+#define HAZARD_STRIDE 8             // 8 pointers = 64 bytes per thread
+
+static inline struct Node **hazardSlot(MSQueue *queue, int thread, int slot)
+{
+    return &queue->hazards[thread * HAZARD_STRIDE + slot];
+}
+
+/*
+ * protect - Publishes *source in a hazard slot and re-reads it until the
+ * published value is still current
+ *
+ * The seq_cst store + re-load pair is what makes the protocol work: once
+ * the re-load agrees, any thread that later retires the node scans after
+ * our store and sees it.
+ */
+static struct Node *protect(MSQueue *queue, int thread, int slot, struct Node **source)
+{
+    struct Node **hazard = hazardSlot(queue, thread, slot);
+    struct Node *node = __atomic_load_n(source, __ATOMIC_ACQUIRE);
+    for (;;)
+    {
+        __atomic_store_n(hazard, node, __ATOMIC_SEQ_CST);
+        struct Node *again = __atomic_load_n(source, __ATOMIC_SEQ_CST);
+        if (again == node)
+            return node;
+        node = again;
+    }
+}
+
+static void clearHazards(MSQueue *queue, int thread)
+{
+    for (int slot = 0; slot < QUEUE_HAZARDS_PER_THREAD; slot++)
+        __atomic_store_n(hazardSlot(queue, thread, slot), NULL, __ATOMIC_RELEASE);
+}
+
+/*
+ * scanRetired - Frees every retired node of `thread` that no hazard slot
+ * names; the rest stay on the list for the next scan
+ *
+ * Time Complexity: O(R * H) for R retired nodes and H slots
+ */
+static void scanRetired(MSQueue *queue, int thread)
+{
+    RetireList *list = &queue->retired[thread];
+    int hazards = queue->maxThreads * QUEUE_HAZARDS_PER_THREAD;
+    struct Node *live[hazards];
+    int liveCount = 0;
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    for (int t = 0; t < queue->maxThreads; t++)
+    {
+        for (int slot = 0; slot < QUEUE_HAZARDS_PER_THREAD; slot++)
+        {
+            struct Node *node = __atomic_load_n(hazardSlot(queue, t, slot), __ATOMIC_ACQUIRE);
+            if (node != NULL)
+                live[liveCount++] = node;
+        }
+    }
+
+    int kept = 0;
+    for (int i = 0; i < list->count; i++)
+    {
+        struct Node *node = list->nodes[i];
+        int hazardous = 0;
+        for (int h = 0; h < liveCount && !hazardous; h++)
+            hazardous = (live[h] == node);
+        if (hazardous)
+            list->nodes[kept++] = node;
+        else
+            free(node);
+    }
+    list->count = kept;
+}
+
+static void retire(MSQueue *queue, int thread, struct Node *node)
+{
+    RetireList *list = &queue->retired[thread];
+    list->nodes[list->count++] = node;
+    if (list->count >= queue->retireThreshold)
+        scanRetired(queue, thread);
+}
+
+/*
+ * createMSQueue - Makes an empty queue for up to maxThreads threads
+ *
+ * Returns: pointer to the queue, or NULL if allocation failed
+ */
+MSQueue *createMSQueue(int maxThreads)
+{
+    if (maxThreads < 1)
+        maxThreads = 1;
+
+    MSQueue *queue = (MSQueue *)malloc(sizeof(MSQueue));
+    if (queue == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    // A scan frees at least threshold - H nodes, so retiring stays O(1) amortized
+    queue->maxThreads = maxThreads;
+    queue->retireThreshold = 2 * maxThreads * QUEUE_HAZARDS_PER_THREAD + 64;
+    queue->hazards = (struct Node **)aligned_alloc(64, maxThreads * HAZARD_STRIDE * sizeof(struct Node *));
+    queue->retired = (RetireList *)calloc(maxThreads, sizeof(RetireList));
+    if (queue->hazards == NULL || queue->retired == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(queue->hazards);
+        free(queue->retired);
+        free(queue);
+        return NULL;
+    }
+
+    for (int i = 0; i < maxThreads * HAZARD_STRIDE; i++)
+        queue->hazards[i] = NULL;
+    queue->head = queue->tail = NULL;       // freeMSQueue may run before the dummy exists
+    for (int t = 0; t < maxThreads; t++)
+    {
+        queue->retired[t].nodes = (struct Node **)malloc(queue->retireThreshold * sizeof(struct Node *));
+        if (queue->retired[t].nodes == NULL)
+        {
+            printf("Memory allocation failed!\n");
+            freeMSQueue(queue);
+            return NULL;
+        }
+    }
+
+    queue->head = queue->tail = CreateNode(0);      // dummy
+    return queue;
+}
+
+/*
+ * freeMSQueue - Frees the queue, its remaining nodes and every retired
+ * node; no thread may still use it
+ */
+void freeMSQueue(MSQueue *queue)
+{
+    if (queue == NULL)
+        return;
+
+    for (int t = 0; t < queue->maxThreads; t++)
+    {
+        for (int i = 0; i < queue->retired[t].count; i++)
+            free(queue->retired[t].nodes[i]);
+        free(queue->retired[t].nodes);
+    }
+
+    struct Node *node = queue->head;
+    while (node != NULL)
+    {
+        struct Node *next = node->Next;
+        free(node);
+        node = next;
+    }
+
+    free(queue->hazards);
+    free(queue->retired);
+    free(queue);
+}
+
+/*
+ * msqEnqueue - Appends value at the tail (insertAtEnd)
+ * @thread: caller's index in [0, maxThreads)
+ *
+ * Time Complexity: O(1) per attempt, lock-free
+ */
+void msqEnqueue(MSQueue *queue, int thread, int value)
+{
+    struct Node *node = CreateNode(value);
+
+    for (;;)
+    {
+        struct Node *tail = protect(queue, thread, 0, &queue->tail);
+        struct Node *next = __atomic_load_n(&tail->Next, __ATOMIC_ACQUIRE);
+        if (tail != __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE))
+            continue;
+
+        if (next != NULL)
+        {
+            // tail lags behind: help move it, then retry
+            __atomic_compare_exchange_n(&queue->tail, &tail, next, 0,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+            continue;
+        }
+
+        struct Node *expected = NULL;
+        if (__atomic_compare_exchange_n(&tail->Next, &expected, node, 0,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        {
+            __atomic_compare_exchange_n(&queue->tail, &tail, node, 0,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+            break;
+        }
+    }
+    clearHazards(queue, thread);
+}
+
+/*
+ * msqDequeue - Removes the front value (deleteFromBeginning)
+ * @thread: caller's index in [0, maxThreads)
+ * @value: out, the removed value
+ *
+ * Returns: 1 on success, 0 if the queue was empty
+ *
+ * Time Complexity: O(1) per attempt, lock-free; O(1) amortized reclamation
+ */
+int msqDequeue(MSQueue *queue, int thread, int *value)
+{
+    struct Node *head;
+    for (;;)
+    {
+        head = protect(queue, thread, 0, &queue->head);
+        struct Node *tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+        struct Node *next = protect(queue, thread, 1, &head->Next);
+        if (head != __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE))
+            continue;
+
+        if (next == NULL)
+        {
+            clearHazards(queue, thread);
+            return 0;
+        }
+        if (head == tail)
+        {
+            __atomic_compare_exchange_n(&queue->tail, &tail, next, 0,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+            continue;
+        }
+
+        // Read the value before the CAS publishes next as the new dummy
+        int data = next->data;
+        if (__atomic_compare_exchange_n(&queue->head, &head, next, 0,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+        {
+            *value = data;
+            break;
+        }
+    }
+
+    clearHazards(queue, thread);
+    retire(queue, thread, head);
+    return 1;
+}
@@ -0,0 +1,59 @@
+#ifndef LOCK_FREE_QUEUE_H
+#define LOCK_FREE_QUEUE_H
+
+#include "singly_linked_list.h"
+
+/*
+ * ============================================================================
+ * LOCK-FREE (MICHAEL-SCOTT) QUEUE WITH HAZARD POINTERS
+ * ============================================================================
+ *
+ * insertAtEnd / deleteFromBeginning without a mutex. head always points to
+ * a dummy node; the real front element is head->Next:
+ *
+ *   head -> [dummy] -> [A] -> [B] -> NULL
+ *                               ^tail (may lag one node behind)
+ *
+ *   enqueue: CAS(tail->Next: NULL -> node), then CAS(tail: old -> node).
+ *            A thread that finds tail->Next != NULL helps swing tail first.
+ *   dequeue: read A's value, CAS(head: dummy -> A); A is the new dummy and
+ *            the old dummy is retired.
+ *
+ * Reclamation: a dequeued dummy may still be read by a stalled thread, so
+ * it is not freed at once. Every thread publishes the (at most two) nodes
+ * it is about to dereference in its hazard pointer slots; retired nodes
+ * are freed in batches, skipping any that some slot still names.
+ *
+ * Each calling thread passes its own index in [0, maxThreads): it selects
+ * the thread's hazard slots and retire list.
+ * ============================================================================
+ */
+
+#define QUEUE_HAZARDS_PER_THREAD 2
+
+typedef struct RetireList
+{
+    struct Node **nodes;
+    int count;
+    char pad[52];                   // one cache line per thread
+} RetireList;
+
+typedef struct MSQueue
+{
+    struct Node *head;
+    char padHead[56];
+    struct Node *tail;
+    char padTail[56];
+    struct Node **hazards;          // [thread * 8 + slot], one cache line per thread
+    RetireList *retired;            // [thread]
+    int maxThreads;
+    int retireThreshold;
+} MSQueue;
+
+MSQueue *createMSQueue(int maxThreads);
+void freeMSQueue(MSQueue *queue);
+
+void msqEnqueue(MSQueue *queue, int thread, int value);
+int msqDequeue(MSQueue *queue, int thread, int *value);
+
+#endif
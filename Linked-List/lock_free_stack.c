@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "lock_free_stack.h"
+
+static inline uint32_t indexOf(uint64_t tagged)
+{
+    return (uint32_t)tagged;
+}
+
+// Same slot, new index, tag + 1 (wraps after 2^32 updates)
+static inline uint64_t nextTagged(uint64_t old, uint32_t index)
+{
+    return ((old >> 32) + 1) << 32 | index;
+}
+
+/*
+ * nodeAt - The node with 1-based index `index`
+ *
+ * An index is only ever seen after the push that published it, which
+ * happened after its block was stored, so the block slot is set.
+ */
+static inline struct StackNode *nodeAt(TreiberStack *stack, uint32_t index)
+{
+    uint32_t i = index - 1;
+    struct StackNodeBlock *block = __atomic_load_n(&stack->blocks[i / STACK_BLOCK_NODES],
+                                                   __ATOMIC_RELAXED);
+    return &block->nodes[i % STACK_BLOCK_NODES];
+}
+
+/*
+ * pushNode - Treiber push of node `index` onto the tagged top word
+ */
+static void pushNode(TreiberStack *stack, uint64_t *top, uint32_t index)
+{
+    struct StackNode *node = nodeAt(stack, index);
+    uint64_t old = __atomic_load_n(top, __ATOMIC_RELAXED);
+    do
+        __atomic_store_n(&node->next, indexOf(old), __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(top, &old, nextTagged(old, index), 1,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+/*
+ * popNode - Treiber pop from the tagged top word
+ *
+ * node->next may be read after another thread popped and reused node;
+ * the value is then garbage but the CAS fails on the tag.
+ *
+ * Returns: the node's index, or 0 if empty
+ */
+static uint32_t popNode(TreiberStack *stack, uint64_t *top)
+{
+    uint64_t old = __atomic_load_n(top, __ATOMIC_ACQUIRE);
+    for (;;)
+    {
+        uint32_t index = indexOf(old);
+        if (index == 0)
+            return 0;
+        uint32_t next = __atomic_load_n(&nodeAt(stack, index)->next, __ATOMIC_RELAXED);
+        if (__atomic_compare_exchange_n(top, &old, nextTagged(old, next), 1,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+            return index;
+    }
+}
+
+/*
+ * allocateNode - Takes a node from the freelist, or carves a new block
+ *
+ * Returns: the node's index, or 0 if allocation failed or every block
+ *          slot is taken
+ */
+static uint32_t allocateNode(TreiberStack *stack)
+{
+    uint32_t index = popNode(stack, &stack->freelist);
+    if (index != 0)
+        return index;
+
+    int id = __atomic_fetch_add(&stack->blockCount, 1, __ATOMIC_RELAXED);
+    if (id >= STACK_MAX_BLOCKS)
+    {
+        printf("Stack is full!\n");
+        return 0;
+    }
+    struct StackNodeBlock *block = (struct StackNodeBlock *)malloc(sizeof(struct StackNodeBlock));
+    if (block == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return 0;
+    }
+
+    // Publish the block, keep its first node, free the rest
+    __atomic_store_n(&stack->blocks[id], block, __ATOMIC_RELAXED);
+    uint32_t first = (uint32_t)id * STACK_BLOCK_NODES + 1;
+    for (uint32_t i = 1; i < STACK_BLOCK_NODES; i++)
+        pushNode(stack, &stack->freelist, first + i);
+    return first;
+}
+
+/*
+ * createTreiberStack - Makes an empty stack
+ *
+ * The block table is calloc'd at its full size; untouched pages of it
+ * cost no memory.
+ *
+ * Returns: pointer to the stack, or NULL if allocation failed
+ */
+TreiberStack *createTreiberStack(void)
+{
+    TreiberStack *stack = (TreiberStack *)malloc(sizeof(TreiberStack));
+    if (stack == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+    stack->blocks = (struct StackNodeBlock **)calloc(STACK_MAX_BLOCKS, sizeof(struct StackNodeBlock *));
+    if (stack->blocks == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(stack);
+        return NULL;
+    }
+    stack->top = 0;
+    stack->freelist = 0;
+    stack->blockCount = 0;
+    return stack;
+}
+
+/*
+ * freeTreiberStack - Frees all node blocks; no thread may still use it
+ */
+void freeTreiberStack(TreiberStack *stack)
+{
+    if (stack == NULL)
+        return;
+
+    int count = stack->blockCount < STACK_MAX_BLOCKS ? stack->blockCount : STACK_MAX_BLOCKS;
+    for (int b = 0; b < count; b++)
+        free(stack->blocks[b]);         // NULL where malloc failed
+    free(stack->blocks);
+    free(stack);
+}
+
+/*
+ * treiberPush - Pushes value (insertAtBeginning)
+ *
+ * Returns: 0 on success, -1 if no node could be allocated
+ *
+ * Time Complexity: O(1) per attempt, lock-free
+ */
+int treiberPush(TreiberStack *stack, int value)
+{
+    uint32_t index = allocateNode(stack);
+    if (index == 0)
+        return -1;
+    nodeAt(stack, index)->data = value;
+    pushNode(stack, &stack->top, index);
+    return 0;
+}
+
+/*
+ * treiberPop - Pops the top value (deleteFromBeginning)
+ * @value: out, the popped value
+ *
+ * Returns: 1 on success, 0 if the stack was empty
+ *
+ * Time Complexity: O(1) per attempt, lock-free
+ */
+int treiberPop(TreiberStack *stack, int *value)
+{
+    uint32_t index = popNode(stack, &stack->top);
+    if (index == 0)
+        return 0;
+    *value = nodeAt(stack, index)->data;
+    pushNode(stack, &stack->freelist, index);
+    return 1;
+}
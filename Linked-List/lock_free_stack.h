@@ -0,0 +1,66 @@
+#ifndef LOCK_FREE_STACK_H
+#define LOCK_FREE_STACK_H
+
+#include <stdint.h>
+
+/*
+ * ============================================================================
+ * LOCK-FREE (TREIBER) STACK
+ * ============================================================================
+ *
+ * insertAtBeginning / deleteFromBeginning without a mutex: `top` is swung
+ * with one CAS per push or pop.
+ *
+ *   push:  node->next = top;           CAS(top: old -> node)
+ *   pop:   node = top, next = node->next;  CAS(top: node -> next)
+ *
+ * ABA: thread A reads top = X, next = Y and stalls; B pops X and Y, then
+ * pushes X again. A's CAS would succeed and install the stale Y. So `top`
+ * is a tagged word: the low 32 bits name the node by index, the high 32
+ * bits are a counter bumped by every successful CAS. A's CAS then fails
+ * because the tag moved on (a false match needs exactly 2^32 updates
+ * during A's stall).
+ *
+ * Nodes live in blocks of STACK_BLOCK_NODES, and node index i (1-based,
+ * 0 = NULL) is slot (i - 1) % STACK_BLOCK_NODES of block
+ * (i - 1) / STACK_BLOCK_NODES. Links are indices too, so a node is
+ * 8 bytes and no address has to fit beside the tag.
+ *
+ * Popped nodes go to a freelist (itself a tagged Treiber stack) and are
+ * reused by later pushes, never free()d while the stack exists, so a
+ * stalled pop can always safely read node->next. When the freelist is
+ * empty a new block is malloc'd.
+ * ============================================================================
+ */
+
+#define STACK_BLOCK_NODES 4096
+#define STACK_MAX_BLOCKS ((1 << 20) - 1)    // keeps every index below 2^32
+
+struct StackNode
+{
+    int data;
+    uint32_t next;                  // index of the node below, 0 = none
+};
+
+struct StackNodeBlock
+{
+    struct StackNode nodes[STACK_BLOCK_NODES];
+};
+
+typedef struct TreiberStack
+{
+    uint64_t top;                   // tag << 32 | node index
+    char padTop[56];                // keep top and freelist on separate cache lines
+    uint64_t freelist;              // tag << 32 | node index
+    char padFree[56];
+    int blockCount;                 // blocks handed out so far (atomic)
+    struct StackNodeBlock **blocks; // STACK_MAX_BLOCKS slots, filled in order
+} TreiberStack;
+
+TreiberStack *createTreiberStack(void);
+void freeTreiberStack(TreiberStack *stack);
+
+int treiberPush(TreiberStack *stack, int value);
+int treiberPop(TreiberStack *stack, int *value);
+
+#endif
@@ -0,0 +1,280 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "shared_list.h"
+
+/*
+ * releaseSharedNode - Epoch release callback: frees a retired node unless
+ * it lives in a slab (the slab goes with freeSharedList)
+ */
+static void releaseSharedNode(void *object)
+{
+    struct Node *node = (struct Node *)object;
+    if (!node->inSlab)
+        free(node);
+}
+
+static struct Node *loadNext(struct Node **link)
+{
+    return __atomic_load_n(link, __ATOMIC_ACQUIRE);
+}
+
+static void publishNext(struct Node **link, struct Node *node)
+{
+    __atomic_store_n(link, node, __ATOMIC_RELEASE);
+}
+
+static void publishSize(SharedList *shared, int size)
+{
+    __atomic_store_n(&shared->list.size, size, __ATOMIC_RELAXED);
+}
+
+/*
+ * createSharedList - Makes an empty shared list for up to maxThreads
+ * reader / writer threads
+ *
+ * Returns: pointer to the list, or NULL if allocation failed
+ */
+SharedList *createSharedList(int maxThreads)
+{
+    SharedList *shared = (SharedList *)malloc(sizeof(SharedList));
+    if (shared == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+    shared->epochs = createEpochDomain(maxThreads, releaseSharedNode);
+    if (shared->epochs == NULL)
+    {
+        free(shared);
+        return NULL;
+    }
+    initList(&shared->list);
+    pthread_mutex_init(&shared->writeLock, NULL);
+    return shared;
+}
+
+/*
+ * sharedListFromArray - createSharedList filled with values[0 .. count-1]
+ * in one slab (listFromArray), before any reader can see it
+ *
+ * Returns: pointer to the list, or NULL if allocation failed
+ *
+ * Time Complexity: O(n), one malloc for the nodes
+ */
+SharedList *sharedListFromArray(const int *values, int count, int maxThreads)
+{
+    SharedList *shared = createSharedList(maxThreads);
+    if (shared == NULL)
+        return NULL;
+    if (listFromArray(&shared->list, values, count) != 0)
+    {
+        freeSharedList(shared);
+        return NULL;
+    }
+    return shared;
+}
+
+/*
+ * freeSharedList - Frees the list, every retired node and the domain;
+ * no other thread may still be using it
+ */
+void freeSharedList(SharedList *shared)
+{
+    if (shared == NULL)
+        return;
+    freeEpochDomain(shared->epochs);        // retired nodes first: they are off the list
+    freeList(&shared->list);
+    pthread_mutex_destroy(&shared->writeLock);
+    free(shared);
+}
+
+/*
+ * sharedInsertAtBeginning - Publishes a new head
+ *
+ * Time Complexity: O(1)
+ */
+void sharedInsertAtBeginning(SharedList *shared, int value)
+{
+    struct Node *node = CreateNode(value);
+    if (node == NULL)
+        return;
+
+    pthread_mutex_lock(&shared->writeLock);
+    List *list = &shared->list;
+    node->Next = list->head;
+    publishNext(&list->head, node);
+    if (list->tail == NULL)
+        list->tail = node;
+    publishSize(shared, list->size + 1);
+    pthread_mutex_unlock(&shared->writeLock);
+}
+
+/*
+ * sharedInsertAtEnd - Publishes a new tail
+ *
+ * Time Complexity: O(1) - the tail is only touched by writers
+ */
+void sharedInsertAtEnd(SharedList *shared, int value)
+{
+    struct Node *node = CreateNode(value);
+    if (node == NULL)
+        return;
+
+    pthread_mutex_lock(&shared->writeLock);
+    List *list = &shared->list;
+    if (list->tail == NULL)
+        publishNext(&list->head, node);
+    else
+        publishNext(&list->tail->Next, node);
+    list->tail = node;
+    publishSize(shared, list->size + 1);
+    pthread_mutex_unlock(&shared->writeLock);
+}
+
+/*
+ * unlinkAfter - Unlinks the node after pred (the head if pred is NULL);
+ * caller holds writeLock
+ *
+ * The victim's own Next is left alone: a reader standing on it goes on
+ * to the rest of the list.
+ */
+static struct Node *unlinkAfter(SharedList *shared, struct Node *pred)
+{
+    List *list = &shared->list;
+    struct Node **link = (pred == NULL) ? &list->head : &pred->Next;
+    struct Node *victim = *link;
+
+    publishNext(link, victim->Next);
+    if (victim == list->tail)
+        list->tail = pred;
+    publishSize(shared, list->size - 1);
+    return victim;
+}
+
+/*
+ * sharedDeleteByValue - Unlinks the first node holding value and retires it
+ * @thread: the caller's index in the epoch domain
+ *
+ * Returns: the deleted value, or -1 if not found. Unlike deleteByValue
+ *          nothing is printed for an empty list: with readers and other
+ *          writers around, that is a normal outcome rather than a misuse.
+ *
+ * Time Complexity: O(n); readers are never blocked
+ */
+int sharedDeleteByValue(SharedList *shared, int thread, int value)
+{
+    pthread_mutex_lock(&shared->writeLock);
+    struct Node *pred = NULL;
+    struct Node *curr = shared->list.head;
+    while (curr != NULL && curr->data != value)
+    {
+        pred = curr;
+        curr = curr->Next;
+    }
+    struct Node *victim = (curr != NULL) ? unlinkAfter(shared, pred) : NULL;
+    pthread_mutex_unlock(&shared->writeLock);
+
+    if (victim == NULL)
+        return -1;
+    epochRetire(shared->epochs, thread, victim);
+    return value;
+}
+
+/*
+ * sharedDeleteAtPosition - Unlinks the node at position and retires it
+ * @thread: the caller's index in the epoch domain
+ *
+ * Returns: the deleted value, or -1 if the position is out of range
+ *          (silently, as in sharedDeleteByValue)
+ *
+ * Time Complexity: O(n) - must traverse to the position
+ */
+int sharedDeleteAtPosition(SharedList *shared, int thread, int position)
+{
+    pthread_mutex_lock(&shared->writeLock);
+    if (position < 0 || position >= shared->list.size)
+    {
+        pthread_mutex_unlock(&shared->writeLock);
+        return -1;
+    }
+
+    struct Node *pred = NULL;
+    for (int i = 0; i < position; i++)
+        pred = (pred == NULL) ? shared->list.head : pred->Next;
+    struct Node *victim = unlinkAfter(shared, pred);
+    pthread_mutex_unlock(&shared->writeLock);
+
+    int value = victim->data;
+    epochRetire(shared->epochs, thread, victim);
+    return value;
+}
+
+/*
+ * sharedSearch - search() without a lock
+ * @thread: the caller's index in the epoch domain
+ *
+ * Returns: position (0-indexed) if found, -1 if not found
+ *
+ * Time Complexity: O(n); two stores to the caller's own epoch slot
+ */
+int sharedSearch(SharedList *shared, int thread, int value)
+{
+    int position = -1;
+    int counter = 0;
+
+    epochEnter(shared->epochs, thread);
+    for (struct Node *curr = loadNext(&shared->list.head); curr != NULL; curr = loadNext(&curr->Next))
+    {
+        if (curr->data == value)
+        {
+            position = counter;
+            break;
+        }
+        counter++;
+    }
+    epochExit(shared->epochs, thread);
+    return position;
+}
+
+/*
+ * sharedGetLength - The current size
+ *
+ * Time Complexity: O(1) - one atomic load, no epoch needed
+ */
+int sharedGetLength(SharedList *shared)
+{
+    return __atomic_load_n(&shared->list.size, __ATOMIC_RELAXED);
+}
+
+/*
+ * sharedGetMiddle - getMiddle() without a lock
+ * @thread: the caller's index in the epoch domain
+ *
+ * Walks size / 2 steps from the head, where size is read once at the
+ * start. If the list shrank meanwhile the walk stops at the last node.
+ *
+ * Returns: data value of the middle node, or -1 if empty
+ *
+ * Time Complexity: O(n) - n / 2 steps
+ */
+int sharedGetMiddle(SharedList *shared, int thread)
+{
+    int steps = sharedGetLength(shared) / 2;
+    int value = -1;
+
+    epochEnter(shared->epochs, thread);
+    struct Node *slow = loadNext(&shared->list.head);
+    if (slow != NULL)
+    {
+        for (int i = 0; i < steps; i++)
+        {
+            struct Node *next = loadNext(&slow->Next);
+            if (next == NULL)
+                break;
+            slow = next;
+        }
+        value = slow->data;
+    }
+    epochExit(shared->epochs, thread);
+    return value;
+}
@@ -0,0 +1,55 @@
+#ifndef SHARED_LIST_H
+#define SHARED_LIST_H
+
+#include <pthread.h>
+#include "singly_linked_list.h"
+#include "epoch.h"
+
+/*
+ * ============================================================================
+ * CONCURRENT-READ SINGLY LIST
+ * ============================================================================
+ *
+ * A List shared by many readers and a writer, where reads take no lock:
+ *
+ *   readers: sharedSearch / sharedGetMiddle   epochEnter .. walk .. epochExit
+ *            sharedGetLength                  one atomic load
+ *   writers: sharedInsert* / sharedDelete*    writeLock, publish, retire
+ *
+ * A writer fills in a node completely and then links it with a release
+ * store, so a reader that loads the pointer (acquire) sees its data. An
+ * unlinked node keeps its Next pointer and is retired to the epoch domain
+ * instead of freed, so a reader standing on it can still step off it.
+ *
+ * Writers are serialized by writeLock (the expected use is one writer);
+ * readers never block them and they never wait for readers. Each thread
+ * passes its own index in [0, maxThreads) to select its epoch slot.
+ *
+ * Reads are not a snapshot: a value inserted or deleted during the call
+ * may or may not be seen, and positions can be off by the number of
+ * concurrent updates. A value present for the whole call is always found,
+ * since nodes never move and an unlinked node still leads back to them.
+ * ============================================================================
+ */
+
+typedef struct SharedList
+{
+    List list;                      // head / Next / size are published atomically
+    pthread_mutex_t writeLock;
+    EpochDomain *epochs;
+} SharedList;
+
+SharedList *createSharedList(int maxThreads);
+SharedList *sharedListFromArray(const int *values, int count, int maxThreads);
+void freeSharedList(SharedList *shared);
+
+void sharedInsertAtBeginning(SharedList *shared, int value);
+void sharedInsertAtEnd(SharedList *shared, int value);
+int sharedDeleteByValue(SharedList *shared, int thread, int value);
+int sharedDeleteAtPosition(SharedList *shared, int thread, int position);
+
+int sharedSearch(SharedList *shared, int thread, int value);
+int sharedGetLength(SharedList *shared);
+int sharedGetMiddle(SharedList *shared, int thread);
+
+#endif
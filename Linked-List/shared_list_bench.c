@@ -0,0 +1,268 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <time.h>
+#include "singly_linked_list.h"
+#include "shared_list.h"
+#include "../Graph/parallel.h"
+
+/*
+ * Read-mostly benchmark for shared_list.c against a pthread rwlock around
+ * the singly List
+ *
+ * The list holds 0 .. n-1. Threads 0 .. writers-1 are writers: for
+ * `seconds` each takes a value out (deleteByValue on its own residue class
+ * mod writers; with one writer deleteAtPosition every 8th time, which
+ * could take another writer's value) and puts it back at the end, so the list always holds between n - writers and n values. All
+ * other threads are readers mixing search / getMiddle / getLength. The
+ * single-writer runs compare against the rwlock; a final epoch run with
+ * several writers exercises concurrent retires. Checks:
+ *   - every read returns something a list of 0 .. n-1 can return
+ *   - every writer finds the value / position it deletes
+ *   - afterwards the list holds each of 0 .. n-1 exactly once
+ *
+ * Build: gcc -O2 -pthread ../Graph/parallel.c singly_linked_list.c epoch.c shared_list.c shared_list_bench.c -o sharedlist
+ * Usage: ./sharedlist [listSize] [seconds] [maxReaders] [writers]
+ */
+
+typedef struct BenchContext
+{
+    int epochMode;              // 1: SharedList, 0: rwlock + List
+    SharedList *shared;
+    List list;
+    pthread_rwlock_t lock;
+    int n;
+    int writers;                // threads 0 .. writers-1
+    double seconds;
+    double end;                 // nowSeconds() at which everybody stops
+    long long reads;            // atomic
+    long long writes;           // atomic
+    int errors;                 // atomic
+} BenchContext;
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int nextRandom(unsigned int *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static void writer(BenchContext *context, int thread)
+{
+    unsigned int rng = 12345u + thread;
+    long long writes = 0;
+    int writers = context->writers;
+    int ownValues = (context->n - 1 - thread) / writers + 1;   // thread, thread + writers, ...
+    int positions = context->n - writers + 1;                  // always present
+
+    while (nowSeconds() < context->end)
+    {
+        int value;
+        if (context->epochMode)
+        {
+            if (writers == 1 && (writes & 7) == 7)
+                value = sharedDeleteAtPosition(context->shared, thread, nextRandom(&rng) % positions);
+            else
+                value = sharedDeleteByValue(context->shared, thread,
+                                            thread + writers * (int)(nextRandom(&rng) % ownValues));
+            if (value >= 0)
+                sharedInsertAtEnd(context->shared, value);
+        }
+        else
+        {
+            pthread_rwlock_wrlock(&context->lock);
+            if (writers == 1 && (writes & 7) == 7)
+                value = deleteAtPosition(&context->list, nextRandom(&rng) % positions);
+            else
+                value = deleteByValue(&context->list, thread + writers * (int)(nextRandom(&rng) % ownValues));
+            if (value >= 0)
+                insertAtEnd(&context->list, value);
+            pthread_rwlock_unlock(&context->lock);
+        }
+        if (value < 0)
+            __atomic_fetch_add(&context->errors, 1, __ATOMIC_RELAXED);
+        writes++;
+    }
+    __atomic_fetch_add(&context->writes, writes, __ATOMIC_RELAXED);
+}
+
+static void reader(BenchContext *context, int thread)
+{
+    unsigned int rng = 0x9e3779b9u * (thread + 1);
+    long long reads = 0;
+    int errors = 0, n = context->n, writers = context->writers;
+
+    // Readers watch the clock too: a reader-preferring rwlock can keep the
+    // writer waiting for the whole run
+    while (nowSeconds() < context->end)
+    {
+        unsigned int r = nextRandom(&rng);
+        int value = r % n;
+        int position, middle, length;
+
+        if (context->epochMode)
+        {
+            position = sharedSearch(context->shared, thread, value);
+            middle = (r & 3) == 0 ? sharedGetMiddle(context->shared, thread) : 0;
+            length = sharedGetLength(context->shared);
+        }
+        else
+        {
+            pthread_rwlock_rdlock(&context->lock);
+            position = search(&context->list, value);
+            middle = (r & 3) == 0 ? getMiddle(&context->list) : 0;
+            length = getLength(&context->list);
+            pthread_rwlock_unlock(&context->lock);
+        }
+
+        // A missing value is fine (the writer may hold it right now), and
+        // without a lock a position can pass n - 1: a value moved to the
+        // end after this reader walked over it is counted twice
+        if (position < -1 || middle < 0 || middle >= n ||
+            length < n - writers || length > n)
+            errors++;
+        reads++;
+    }
+    __atomic_fetch_add(&context->reads, reads, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&context->errors, errors, __ATOMIC_RELAXED);
+}
+
+static void benchWorker(void *arg, int thread, int threads)
+{
+    (void)threads;
+    if (thread < ((BenchContext *)arg)->writers)
+        writer((BenchContext *)arg, thread);
+    else
+        reader((BenchContext *)arg, thread);
+}
+
+/*
+ * holdsEachOnce - 1 if list holds every value of 0 .. n-1 exactly once
+ */
+static int holdsEachOnce(List *list, int n)
+{
+    int *values = (int *)malloc(n * sizeof(int));
+    char *seen = (char *)calloc(n, 1);
+    if (values == NULL || seen == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    int ok = getLength(list) == n && listToArray(list, values) == n;
+    for (int i = 0; ok && i < n; i++)
+    {
+        if (values[i] < 0 || values[i] >= n || seen[values[i]])
+            ok = 0;
+        else
+            seen[values[i]] = 1;
+    }
+    free(values);
+    free(seen);
+    return ok;
+}
+
+static int runBench(int epochMode, int writers, int readers, int n, double seconds,
+                    const int *values)
+{
+    BenchContext context;
+    context.epochMode = epochMode;
+    context.shared = NULL;
+    context.n = n;
+    context.writers = writers;
+    context.seconds = seconds;
+    context.reads = 0;
+    context.writes = 0;
+    context.errors = 0;
+    pthread_rwlock_init(&context.lock, NULL);
+    if (epochMode)
+        context.shared = sharedListFromArray(values, n, writers + readers);
+    else
+        listFromArray(&context.list, values, n);
+
+    context.end = nowSeconds() + seconds;
+    parallelRun(writers + readers, benchWorker, &context);
+
+    long long pending = 0;
+    int ok;
+    if (epochMode)
+    {
+        pending = epochPending(context.shared->epochs);
+        ok = holdsEachOnce(&context.shared->list, n);
+        freeSharedList(context.shared);
+    }
+    else
+    {
+        ok = holdsEachOnce(&context.list, n);
+        freeList(&context.list);
+    }
+    pthread_rwlock_destroy(&context.lock);
+    ok = ok && context.errors == 0;
+
+    printf("  %-6s %d writer%s %2d readers: %8.0f reads/s  %8.0f writes/s", epochMode ? "epoch" : "rwlock",
+           writers, writers > 1 ? "s" : " ", readers, context.reads / seconds, context.writes / seconds);
+    if (epochMode)
+        printf("  (%lld nodes in limbo)", pending);
+    printf("  %s\n", ok ? "OK" : "MISMATCH");
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    int n = (argc > 1) ? atoi(argv[1]) : 10000;
+    double seconds = (argc > 2) ? atof(argv[2]) : 1.0;
+    int maxReaders = (argc > 3) ? atoi(argv[3]) : defaultThreadCount();
+    int writers = (argc > 4) ? atoi(argv[4]) : 4;
+    if (n < 2)
+        n = 2;
+    if (maxReaders < 2)
+        maxReaders = 2;     // oversubscribed on small machines, still exercises the races
+    if (writers < 2)
+        writers = 2;
+    if (writers > n / 2)
+        writers = n / 2;
+
+    // ---- Demo ----
+    SharedList *demo = createSharedList(1);
+    for (int value = 10; value <= 50; value += 10)
+        sharedInsertAtEnd(demo, value);
+    sharedInsertAtBeginning(demo, 5);
+    sharedDeleteByValue(demo, 0, 30);
+    sharedDeleteAtPosition(demo, 0, 0);
+    printList(&demo->list);                                         // 10 -> 20 -> 40 -> 50
+    printf("Length %d, middle %d, search 40: %d, search 30: %d\n", sharedGetLength(demo),
+           sharedGetMiddle(demo, 0), sharedSearch(demo, 0, 40), sharedSearch(demo, 0, 30));
+    freeSharedList(demo);
+
+    int *values = (int *)malloc(n * sizeof(int));
+    if (values == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+    for (int i = 0; i < n; i++)
+        values[i] = i;
+
+    int ok = 1;
+    printf("\n%d-element list, 1 writer, %.1f s per run\n", n, seconds);
+    for (int readers = 1; readers <= maxReaders; readers *= 2)
+    {
+        ok = runBench(0, 1, readers, n, seconds, values) && ok;
+        ok = runBench(1, 1, readers, n, seconds, values) && ok;
+    }
+
+    // Several writers retiring at once: the race epochRetire's fence closes
+    printf("\n%d writers, %d readers\n", writers, maxReaders);
+    ok = runBench(1, writers, maxReaders, n, seconds, values) && ok;
+
+    free(values);
+    printf("\n%s\n", ok ? "All checks OK" : "CHECK FAILED");
+    return ok ? 0 : 1;
+}
@@ -1,22 +1,7 @@
 #include <stdlib.h>
 #include <stdio.h>
-
-/*
- * Structure definition for a Singly Linked List Node
- * Each node contains:
- * - data: the integer value stored in the node
- * - Next: pointer to the next node in the list (NULL if last node)
- * 
- * Unlike doubly linked lists, singly linked lists can only traverse forward
- */
-struct Node
-{
-    int data;
-    struct Node *Next;
-};
-
-/* Global head pointer - initialized to NULL (empty list) */
-struct Node *head = NULL;
+#include <string.h>
+#include "singly_linked_list.h"
 
 /*
  * CreateNode - Allocates and initializes a new singly linked list node
@@ -31,25 +16,256 @@ struct Node *CreateNode(int value)
 {
     // Allocate memory for the new node
     struct Node *new = (struct Node *)malloc(sizeof(struct Node));
+    if (new == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
 
     // Initialize the node's fields
     new->data = value;
+    new->inSlab = 0;
     new->Next = NULL;
 
     return new;
 }
 
+/*
+ * releaseNode - Frees a node that was unlinked from a list
+ * 
+ * Slab nodes are skipped: they belong to a larger allocation that
+ * freeList releases as a whole.
+ */
+static void releaseNode(struct Node *node)
+{
+    if (!node->inSlab)
+        free(node);
+}
+
+/*
+ * hashValue - murmur3 finalizer, spreads nearby ints over the table
+ */
+static unsigned int hashValue(int value)
+{
+    unsigned int h = (unsigned int)value;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+static IndexEntry *indexFind(ListIndex *index, int key)
+{
+    unsigned int mask = (unsigned int)index->capacity - 1;
+    for (unsigned int i = hashValue(key) & mask; index->slots[i].count != 0; i = (i + 1) & mask)
+    {
+        if (index->slots[i].key == key)
+            return &index->slots[i];
+    }
+    return NULL;
+}
+
+/*
+ * indexSlotFor - First empty slot on key's probe path (key must be absent)
+ */
+static IndexEntry *indexSlotFor(ListIndex *index, int key)
+{
+    unsigned int mask = (unsigned int)index->capacity - 1;
+    unsigned int i = hashValue(key) & mask;
+    while (index->slots[i].count != 0)
+        i = (i + 1) & mask;
+    return &index->slots[i];
+}
+
+static void indexResize(ListIndex *index, int capacity)
+{
+    IndexEntry *old = index->slots;
+    int oldCapacity = index->capacity;
+
+    index->slots = (IndexEntry *)calloc(capacity, sizeof(IndexEntry));
+    if (index->slots == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    index->capacity = capacity;
+
+    for (int i = 0; i < oldCapacity; i++)
+    {
+        if (old[i].count != 0)
+            *indexSlotFor(index, old[i].key) = old[i];
+    }
+    free(old);
+}
+
+/*
+ * indexAdd - New entry for a value that is not in the index yet
+ */
+static void indexAdd(ListIndex *index, int key, struct Node *node, struct Node *pred)
+{
+    if ((index->used + 1) * 2 > index->capacity)
+        indexResize(index, index->capacity * 2);
+
+    IndexEntry *entry = indexSlotFor(index, key);
+    entry->key = key;
+    entry->count = 1;
+    entry->node = node;
+    entry->pred = pred;
+    index->used++;
+}
+
+/*
+ * indexErase - Empties an entry, shifting later entries of the probe run
+ * back so no tombstones are needed
+ */
+static void indexErase(ListIndex *index, IndexEntry *entry)
+{
+    unsigned int mask = (unsigned int)index->capacity - 1;
+    unsigned int hole = (unsigned int)(entry - index->slots);
+    unsigned int i = hole;
+
+    for (;;)
+    {
+        i = (i + 1) & mask;
+        if (index->slots[i].count == 0)
+            break;
+
+        // An entry may fill the hole only if its home slot is not in (hole, i]
+        unsigned int home = hashValue(index->slots[i].key) & mask;
+        int movable = (hole <= i) ? (home <= hole || home > i) : (home <= hole && home > i);
+        if (movable)
+        {
+            index->slots[hole] = index->slots[i];
+            hole = i;
+        }
+    }
+    index->slots[hole].count = 0;
+    index->used--;
+}
+
+/*
+ * fixPredecessor - node now follows pred; update its entry if it is the
+ * indexed (first) occurrence of its value
+ */
+static void fixPredecessor(ListIndex *index, struct Node *node, struct Node *pred)
+{
+    if (node == NULL)
+        return;
+    IndexEntry *entry = indexFind(index, node->data);
+    if (entry != NULL && entry->node == node)
+        entry->pred = pred;
+}
+
+/*
+ * indexAppended - node was linked as the new tail after pred
+ *
+ * An appended node can never be the first occurrence of an existing value.
+ */
+static void indexAppended(List *list, struct Node *node, struct Node *pred)
+{
+    if (list->index == NULL)
+        return;
+    IndexEntry *entry = indexFind(list->index, node->data);
+    if (entry == NULL)
+        indexAdd(list->index, node->data, node, pred);
+    else
+        entry->count++;
+}
+
+/*
+ * indexLinked - node was linked in after pred (NULL: at the head)
+ *
+ * O(1), except for a duplicate inserted in the middle: then a walk from
+ * node decides whether it now comes before the indexed occurrence.
+ */
+static void indexLinked(List *list, struct Node *node, struct Node *pred)
+{
+    ListIndex *index = list->index;
+    if (index == NULL)
+        return;
+
+    fixPredecessor(index, node->Next, node);
+
+    IndexEntry *entry = indexFind(index, node->data);
+    if (entry == NULL)
+    {
+        indexAdd(index, node->data, node, pred);
+        return;
+    }
+    entry->count++;
+
+    int first = (pred == NULL || entry->node == node->Next);
+    for (struct Node *curr = node->Next; !first && curr != NULL; curr = curr->Next)
+        first = (curr == entry->node);
+    if (first)
+    {
+        entry->node = node;
+        entry->pred = pred;
+    }
+}
+
+/*
+ * indexUnlinked - node was unlinked from after pred; node->Next is still
+ * its old successor
+ *
+ * O(1), except when the first of several duplicates goes: then the next
+ * occurrence is found by walking on from node.
+ */
+static void indexUnlinked(List *list, struct Node *node, struct Node *pred)
+{
+    ListIndex *index = list->index;
+    if (index == NULL)
+        return;
+
+    fixPredecessor(index, node->Next, pred);
+
+    IndexEntry *entry = indexFind(index, node->data);
+    if (--entry->count == 0)
+    {
+        indexErase(index, entry);
+        return;
+    }
+    if (entry->node != node)
+        return;
+
+    struct Node *before = pred;
+    for (struct Node *curr = node->Next; curr != NULL; before = curr, curr = curr->Next)
+    {
+        if (curr->data == node->data)
+        {
+            entry->node = curr;
+            entry->pred = before;
+            return;
+        }
+    }
+}
+
+/*
+ * initList - Makes an empty list: no head, no tail, size 0
+ * @list: the handle to initialize
+ */
+void initList(List *list)
+{
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->slabs = NULL;
+    list->index = NULL;
+}
+
 /*
  * printList - Traverses and prints all elements in the list
- * @HEAD: pointer to the first node of the list
+ * @list: the list to print
  * 
  * Output format: "LL elements: val1 -> val2 -> ... -> NULL"
  * 
  * Time Complexity: O(n) - must visit every node
  */
-void printList(struct Node *HEAD)
+void printList(List *list)
 {
-    struct Node *current = HEAD;
+    struct Node *current = list->head;
     printf("LL elements: ");
     
     // Traverse until we reach the end (NULL)
@@ -63,7 +279,7 @@ void printList(struct Node *HEAD)
 
 /*
  * insertAtBeginning - Inserts a new node at the start of the list
- * @head: double pointer to the head (allows modification of head pointer)
+ * @list: the list to insert into
  * @value: the integer value to insert
  * 
  * Time Complexity: O(1) - constant time, no traversal needed
@@ -71,68 +287,87 @@ void printList(struct Node *HEAD)
  * Before: head -> [A] -> [B] -> ...
  * After:  head -> [NEW] -> [A] -> [B] -> ...
  */
-void insertAtBeginning(struct Node **head, int value)
+void insertAtBeginning(List *list, int value)
 {
     // Create the new node
     struct Node *new = CreateNode(value);
 
     // Point new node to current head
-    new->Next = *head;
+    new->Next = list->head;
     
     // Update head to point to new node
-    *head = new;
+    list->head = new;
+
+    // First node is also the last one
+    if (list->tail == NULL)
+        list->tail = new;
+    list->size++;
+    indexLinked(list, new, NULL);
 }
 
 /*
  * insertAtEnd - Inserts a new node at the end of the list
- * @head: double pointer to the head
+ * @list: the list to insert into
  * @value: the integer value to insert
  * 
- * Time Complexity: O(n) - must traverse entire list to find the end
+ * Time Complexity: O(1) - the tail pointer gives the last node directly
  * 
  * Before: ... -> [Y] -> [Z] -> NULL
  * After:  ... -> [Y] -> [Z] -> [NEW] -> NULL
  */
-void insertAtEnd(struct Node **head, int value)
+void insertAtEnd(List *list, int value)
 {
     // Create the new node
     struct Node *new = CreateNode(value);
     
     // Special case: if list is empty, new node becomes the head
-    if (*head == NULL)
+    if (list->head == NULL)
     {
-        *head = new;
+        list->head = new;
+        list->tail = new;
+        list->size = 1;
+        indexAppended(list, new, NULL);
         return;
     }
 
-    // Traverse to find the last node (node whose Next is NULL)
-    struct Node *curr = *head;
-    while (curr->Next != NULL)
-    {
-        curr = curr->Next;
-    }
-    
     // Link the last node to our new node
-    curr->Next = new;
+    struct Node *pred = list->tail;
+    pred->Next = new;
+    list->tail = new;
+    list->size++;
+    indexAppended(list, new, pred);
 }
 
 /*
  * insertAtPosition - Inserts a new node at a specific position (0-indexed)
- * @head: double pointer to the head
+ * @list: the list to insert into
  * @value: the integer value to insert
- * @position: the index where to insert (0 = beginning)
+ * @position: the index where to insert (0 = beginning, size = end)
  * 
  * Time Complexity: O(n) - must traverse to the position
+ *                  (O(1) for position 0 and position size)
  * 
  * Example: Insert at position 2 in list [A, B, C, D]
  * Result: [A, B, NEW, C, D]
  */
-void insertAtPosition(struct Node **head, int value, int position)
+void insertAtPosition(List *list, int value, int position)
 {
-    // Special case: inserting at beginning (position 0)
+    // The cached size rejects bad positions before any traversal
+    if (position < 0 || position > list->size)
+    {
+        printf("Position out of range!\n");
+        return;
+    }
+
+    // Special cases: inserting at beginning or end
     if (position == 0)
     {
-        insertAtBeginning(head, value);
+        insertAtBeginning(list, value);
+        return;
+    }
+    if (position == list->size)
+    {
+        insertAtEnd(list, value);
         return;
     }
 
@@ -140,15 +375,9 @@ void insertAtPosition(struct Node **head, int value, int position)
     struct Node *newNode = CreateNode(value);
 
     // Traverse to the node just BEFORE the target position
-    struct Node *current = *head;
+    struct Node *current = list->head;
     for (int i = 0; i < position - 1; i++)
     {
-        // Check if we've gone past the end
-        if (current == NULL)
-        {
-            printf("Position out of range!\n");
-            return;
-        }
         current = current->Next;
     }
 
@@ -156,40 +385,48 @@ void insertAtPosition(struct Node **head, int value, int position)
     // Previous node now points to new node
     newNode->Next = current->Next;
     current->Next = newNode;
+    list->size++;
+    indexLinked(list, newNode, current);
 }
 
 /*
  * insertSorted - Inserts a value in sorted (ascending) order
- * @head: double pointer to the head
+ * @list: the list to insert into
  * @value: the integer value to insert
  * 
  * Assumes: List is already sorted in ascending order
  * Maintains: Sorted order after insertion
  * 
  * Time Complexity: O(n) - may need to traverse entire list
+ *                  (O(1) when value is >= the tail, e.g. ascending input)
  * 
  * Example: Insert 25 into [10, 20, 30, 40]
  * Result: [10, 20, 25, 30, 40]
  */
-void insertSorted(struct Node **head, int value)
+void insertSorted(List *list, int value)
 {
-    struct Node *newNode = CreateNode(value);
-
     // Case 1: Empty list OR value should be first (smaller than head)
-    if (*head == NULL || (*head)->data >= value)
+    if (list->head == NULL || list->head->data >= value)
+    {
+        insertAtBeginning(list, value);
+        return;
+    }
+
+    // Case 2: Value belongs after the last node
+    if (list->tail->data < value)
     {
-        newNode->Next = *head;
-        *head = newNode;
+        insertAtEnd(list, value);
         return;
     }
 
-    // Case 2: Find correct position in the middle or end
-    struct Node *curr = *head;
+    // Case 3: Find correct position in the middle
+    struct Node *newNode = CreateNode(value);
+    struct Node *curr = list->head;
 
     // Move until we find position where:
     // curr->data < value <= curr->Next->data
-    // We stop when next node is NULL or next node's data >= value
-    while (curr->Next != NULL && curr->Next->data < value)
+    // We stop when next node's data >= value (the tail guarantees one exists)
+    while (curr->Next->data < value)
     {
         curr = curr->Next;
     }
@@ -197,11 +434,396 @@ void insertSorted(struct Node **head, int value)
     // Insert after curr
     newNode->Next = curr->Next;
     curr->Next = newNode;
+    list->size++;
+    indexLinked(list, newNode, curr);
+}
+
+/*
+ * appendList - Moves every node of other to the end of list (splice)
+ * @list: the list to append to
+ * @other: the list whose nodes are moved; left empty afterwards
+ * 
+ * No node is copied or allocated: the tail of list is linked to the head
+ * of other and the two sizes are added. Slabs owned by other move along
+ * with their nodes; other's index (if any) is dropped.
+ * 
+ * Time Complexity: O(1) (plus one step per slab other owns), O(m) for
+ *                  the m moved nodes if list has an index
+ * 
+ * Before: list: [A] -> [B] -> NULL      other: [C] -> [D] -> NULL
+ * After:  list: [A] -> [B] -> [C] -> [D] -> NULL      other: empty
+ */
+void appendList(List *list, List *other)
+{
+    if (other->head == NULL || list == other)
+        return;
+
+    struct Node *pred = list->tail;
+    if (list->head == NULL)
+        list->head = other->head;
+    else
+        list->tail->Next = other->head;
+
+    list->tail = other->tail;
+    list->size += other->size;
+
+    if (list->index != NULL)
+    {
+        for (struct Node *curr = other->head; curr != NULL; pred = curr, curr = curr->Next)
+            indexAppended(list, curr, pred);
+    }
+    disableListIndex(other);
+
+    if (other->slabs != NULL)
+    {
+        struct NodeSlab *last = other->slabs;
+        while (last->next != NULL)
+            last = last->next;
+        last->next = list->slabs;
+        list->slabs = other->slabs;
+    }
+    initList(other);
+}
+
+/*
+ * listFromArray - Makes list hold values[0 .. count-1], in order
+ * @list: the handle to initialize (any previous contents are not freed)
+ * @values: the elements
+ * @count: number of elements
+ * 
+ * Returns: 0 on success, -1 if allocation failed (list is then empty)
+ * 
+ * Time Complexity: O(n), one malloc
+ */
+int listFromArray(List *list, const int *values, int count)
+{
+    initList(list);
+    return appendArray(list, values, count);
+}
+
+/*
+ * appendArray - Appends values[0 .. count-1] in one contiguous NodeSlab
+ * @list: the list to append to
+ * @values: the elements
+ * @count: number of elements
+ * 
+ * The nodes are linked while they are written, so the slab is a ready
+ * list that is spliced onto the tail like appendList.
+ * 
+ * Returns: 0 on success, -1 if allocation failed (list unchanged)
+ * 
+ * Time Complexity: O(n), one malloc
+ */
+int appendArray(List *list, const int *values, int count)
+{
+    if (count <= 0)
+        return 0;
+
+    struct NodeSlab *slab = (struct NodeSlab *)malloc(sizeof(struct NodeSlab) +
+                                                      (size_t)count * sizeof(struct Node));
+    if (slab == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return -1;
+    }
+    slab->count = count;
+
+    for (int i = 0; i < count; i++)
+    {
+        slab->nodes[i].data = values[i];
+        slab->nodes[i].inSlab = 1;
+        slab->nodes[i].Next = &slab->nodes[i + 1];
+    }
+    slab->nodes[count - 1].Next = NULL;
+
+    struct Node *pred = list->tail;
+    if (list->head == NULL)
+        list->head = &slab->nodes[0];
+    else
+        list->tail->Next = &slab->nodes[0];
+    list->tail = &slab->nodes[count - 1];
+    list->size += count;
+
+    for (int i = 0; i < count && list->index != NULL; i++)
+    {
+        indexAppended(list, &slab->nodes[i], pred);
+        pred = &slab->nodes[i];
+    }
+
+    slab->next = list->slabs;
+    list->slabs = slab;
+    return 0;
+}
+
+/*
+ * listToArray - Copies the elements, in list order, into values
+ * @list: the list to read
+ * @values: output, room for getLength(list) ints
+ * 
+ * Returns: number of elements written
+ * 
+ * Time Complexity: O(n)
+ */
+int listToArray(List *list, int *values)
+{
+    int count = 0;
+    for (struct Node *curr = list->head; curr != NULL; curr = curr->Next)
+        values[count++] = curr->data;
+    return count;
+}
+
+/*
+ * freeList - Frees every node and slab and leaves the list empty
+ * @list: the list to free
+ * 
+ * Individually allocated nodes are freed one by one; slab nodes are
+ * skipped and each slab is freed in one call, including slab nodes that
+ * were already deleted from the list. An index stays enabled, empty.
+ * 
+ * Time Complexity: O(n)
+ */
+void freeList(List *list)
+{
+    struct Node *curr = list->head;
+    while (curr != NULL)
+    {
+        struct Node *next = curr->Next;
+        releaseNode(curr);
+        curr = next;
+    }
+
+    struct NodeSlab *slab = list->slabs;
+    while (slab != NULL)
+    {
+        struct NodeSlab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+
+    ListIndex *index = list->index;
+    initList(list);
+    list->index = index;
+    rebuildListIndex(list);
+}
+
+/*
+ * enableListIndex - Builds a hash index over the current contents
+ * @list: the list to index
+ * 
+ * From now on listContains and deleteByValue are O(1) expected, and search
+ * returns -1 for an absent value in O(1). Costs one 24-byte entry per
+ * distinct value (at most half the slots used).
+ * 
+ * Returns: 0 on success (or already enabled), -1 if allocation failed
+ * 
+ * Time Complexity: O(n)
+ */
+int enableListIndex(List *list)
+{
+    if (list->index != NULL)
+        return 0;
+
+    ListIndex *index = (ListIndex *)malloc(sizeof(ListIndex));
+    if (index == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return -1;
+    }
+    index->slots = NULL;
+    index->capacity = 0;
+    index->used = 0;
+
+    list->index = index;
+    rebuildListIndex(list);
+    return 0;
+}
+
+/*
+ * disableListIndex - Frees the index; the list itself is untouched
+ */
+void disableListIndex(List *list)
+{
+    if (list->index == NULL)
+        return;
+    free(list->index->slots);
+    free(list->index);
+    list->index = NULL;
+}
+
+/*
+ * rebuildListIndex - Recomputes the index from the list
+ * @list: the list (no-op without an index)
+ * 
+ * Needed after anything that relinks nodes wholesale (reverseList,
+ * sortList); the per-node insert and delete paths never need it.
+ * 
+ * Time Complexity: O(n)
+ */
+void rebuildListIndex(List *list)
+{
+    ListIndex *index = list->index;
+    if (index == NULL)
+        return;
+
+    int capacity = 16;
+    while (capacity < 2 * list->size)
+        capacity *= 2;
+    if (capacity != index->capacity)
+    {
+        free(index->slots);
+        index->slots = (IndexEntry *)malloc(capacity * sizeof(IndexEntry));
+        if (index->slots == NULL)
+        {
+            printf("Memory allocation failed!\n");
+            exit(1);
+        }
+        index->capacity = capacity;
+    }
+    memset(index->slots, 0, capacity * sizeof(IndexEntry));
+    index->used = 0;
+
+    struct Node *pred = NULL;
+    for (struct Node *curr = list->head; curr != NULL; pred = curr, curr = curr->Next)
+        indexAppended(list, curr, pred);
+}
+
+/*
+ * listContains - 1 if value is in the list, 0 otherwise
+ * 
+ * Time Complexity: O(1) expected with an index, O(n) without
+ */
+int listContains(List *list, int value)
+{
+    if (list->index != NULL)
+        return indexFind(list->index, value) != NULL;
+    return search(list, value) != -1;
+}
+
+/*
+ * compactBegin - Prepares to move every node into one fresh slab
+ * @list: the list to compact
+ * @state: progress record, passed to every compactStep
+ * 
+ * Nothing moves yet. The new slab goes first in list->slabs and the old
+ * slabs stay behind it until the last step, so freeList is safe at any
+ * point in between.
+ * 
+ * Returns: 0 on success, -1 if allocation failed (list unchanged)
+ */
+int compactBegin(List *list, CompactState *state)
+{
+    state->arena = NULL;
+    state->prev = NULL;
+    state->curr = list->head;
+    state->moved = 0;
+    if (list->size == 0)
+        return 0;
+
+    state->arena = (struct NodeSlab *)malloc(sizeof(struct NodeSlab) +
+                                             (size_t)list->size * sizeof(struct Node));
+    if (state->arena == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return -1;
+    }
+    state->arena->count = list->size;
+    state->arena->next = list->slabs;
+    list->slabs = state->arena;
+    return 0;
+}
+
+/*
+ * compactStep - Relocates up to maxNodes more nodes into the arena
+ * @list: the list being compacted
+ * @state: progress from compactBegin
+ * @maxNodes: work bound for this call
+ * 
+ * Between steps the list is fully valid: a relocated prefix followed by
+ * the untouched rest. It may be read (printList, search, ...) but must
+ * not be modified until the compaction is done. Pointers to individual
+ * nodes held elsewhere are invalidated as their nodes move.
+ * 
+ * Returns: 1 when the whole list has moved (old slabs are then freed),
+ *          0 if more steps are needed
+ * 
+ * Time Complexity: O(maxNodes) per call
+ */
+int compactStep(List *list, CompactState *state, int maxNodes)
+{
+    for (int i = 0; i < maxNodes && state->curr != NULL; i++)
+    {
+        struct Node *old = state->curr;
+        struct Node *node = &state->arena->nodes[state->moved++];
+
+        node->data = old->data;
+        node->inSlab = 1;
+        node->Next = old->Next;
+
+        if (state->prev == NULL)
+            list->head = node;
+        else
+            state->prev->Next = node;
+        if (list->tail == old)
+            list->tail = node;
+
+        if (list->index != NULL)
+        {
+            IndexEntry *entry = indexFind(list->index, old->data);
+            if (entry->node == old)
+            {
+                entry->node = node;
+                entry->pred = state->prev;
+            }
+            fixPredecessor(list->index, node->Next, node);
+        }
+
+        state->prev = node;
+        state->curr = old->Next;
+        releaseNode(old);
+    }
+
+    if (state->curr != NULL)
+        return 0;
+
+    // Every node moved: the slabs behind the arena are now unreferenced
+    if (state->arena != NULL)
+    {
+        struct NodeSlab *slab = state->arena->next;
+        while (slab != NULL)
+        {
+            struct NodeSlab *next = slab->next;
+            free(slab);
+            slab = next;
+        }
+        state->arena->next = NULL;
+    }
+    return 1;
+}
+
+/*
+ * compactList - Moves every node, in list order, into one contiguous slab
+ * @list: the list to compact
+ * 
+ * After a long run of inserts and deletes the nodes are scattered over the
+ * heap and every Next is a cache miss; afterwards a traversal walks
+ * consecutive addresses again. Freed slots of old slabs are returned too.
+ * 
+ * Returns: 0 on success, -1 if allocation failed (list unchanged)
+ * 
+ * Time Complexity: O(n)
+ */
+int compactList(List *list)
+{
+    CompactState state;
+    if (compactBegin(list, &state) != 0)
+        return -1;
+    compactStep(list, &state, list->size);
+    return 0;
 }
 
 /*
  * deleteFromBeginning - Removes and returns the first node
- * @head: double pointer to the head
+ * @list: the list to delete from
  * 
  * Returns: data value of deleted node, or -1 if list is empty
  * 
@@ -210,93 +832,121 @@ void insertSorted(struct Node **head, int value)
  * Before: head -> [A] -> [B] -> ...
  * After:  head -> [B] -> ...
  */
-int deleteFromBeginning(struct Node **head)
+int deleteFromBeginning(List *list)
 {
     // Check if list is empty
-    if (*head == NULL)
+    if (list->head == NULL)
     {
         printf("List is empty!\n");
         return -1;
     }
 
-    struct Node *temp = *head;           // Save reference to node being deleted
+    struct Node *temp = list->head;      // Save reference to node being deleted
     int deletedvalue = temp->data;       // Save the data before freeing
-    (*head) = (*head)->Next;             // Move head to second node
-    free(temp);                          // Free the old head
+    list->head = list->head->Next;       // Move head to second node
+    indexUnlinked(list, temp, NULL);
+    releaseNode(temp);                   // Free the old head
+
+    // Removed the only node: the list is empty again
+    if (list->head == NULL)
+        list->tail = NULL;
+    list->size--;
 
     return deletedvalue;
 }
 
 /*
  * deleteFromEnd - Removes and returns the last node
- * @head: double pointer to the head
+ * @list: the list to delete from
  * 
  * Returns: data value of deleted node, or -1 if list is empty
  * 
- * Time Complexity: O(n) - must traverse to find second-to-last node
+ * Time Complexity: O(n) - the tail is known, but the new tail (second-to-
+ *                  last node) can only be found by walking from the head
  * 
  * Before: ... -> [Y] -> [Z] -> NULL
  * After:  ... -> [Y] -> NULL
  */
-int deleteFromEnd(struct Node **head)
+int deleteFromEnd(List *list)
 {
     // Case 1: Empty list
-    if (*head == NULL)
+    if (list->head == NULL)
     {
         printf("List is empty!\n");
         return -1;
     }
     
     // Case 2: Only one node in list
-    if ((*head)->Next == NULL)
+    if (list->head->Next == NULL)
     {
-        int deletedValue = (*head)->data;
-        free(*head);
-        *head = NULL;                    // List is now empty
-        return deletedValue;
+        return deleteFromBeginning(list);
     }
 
     // Case 3: Multiple nodes - find second-to-last
-    struct Node *curr = *head;
-    while (curr->Next->Next != NULL)    // Stop when curr->Next is the last node
+    struct Node *curr = list->head;
+    while (curr->Next != list->tail)     // Stop when curr->Next is the last node
     {
         curr = curr->Next;
     }
 
     // curr is now second-to-last, curr->Next is last
-    int deletedValue = curr->Next->data;
-    free(curr->Next);                    // Free the last node
+    int deletedValue = list->tail->data;
     curr->Next = NULL;                   // Second-to-last becomes last
+    indexUnlinked(list, list->tail, curr);
+    releaseNode(list->tail);             // Free the last node
+    list->tail = curr;
+    list->size--;
 
     return deletedValue;
 }
 
 /*
  * deleteByValue - Searches for and deletes the first node with matching value
- * @head: double pointer to the head
+ * @list: the list to delete from
  * @value: the value to search for and delete
  * 
  * Returns: the deleted value, or -1 if not found/empty
  * 
  * Time Complexity: O(n) - may need to search entire list
+ *                  (O(1) expected with an index: it names the predecessor)
  */
-int deleteByValue(struct Node **head, int value)
+int deleteByValue(List *list, int value)
 {
     // Case 1: Empty list
-    if (*head == NULL)
+    if (list->head == NULL)
     {
         printf("List is empty!\n");
         return -1;
     }
+
+    // Indexed: jump straight to the predecessor
+    if (list->index != NULL)
+    {
+        IndexEntry *entry = indexFind(list->index, value);
+        if (entry == NULL)
+            return -1;
+        struct Node *pred = entry->pred;
+        if (pred == NULL)
+            return deleteFromBeginning(list);
+
+        struct Node *temp = pred->Next;
+        pred->Next = temp->Next;
+        if (temp == list->tail)
+            list->tail = pred;
+        list->size--;
+        indexUnlinked(list, temp, pred);
+        releaseNode(temp);
+        return value;
+    }
     
     // Case 2: Value is in the first node (head)
-    if ((*head)->data == value)
+    if (list->head->data == value)
     {
-        return deleteFromBeginning(head);
+        return deleteFromBeginning(list);
     }
 
     // Case 3: Search for value in rest of list
-    struct Node *curr = *head;
+    struct Node *curr = list->head;
     while (curr->Next != NULL)
     {
         // Look ahead to next node
@@ -305,82 +955,83 @@ int deleteByValue(struct Node **head, int value)
             struct Node *temp = curr->Next;          // Node to delete
             int deletedvalue = curr->Next->data;
             curr->Next = curr->Next->Next;           // Bypass the deleted node
-            free(temp);
+            if (temp == list->tail)                  // Deleted the last node
+                list->tail = curr;
+            releaseNode(temp);
+            list->size--;
             return deletedvalue;
         }
         curr = curr->Next;
     }
     
-    // Note: Function should return -1 here if value not found
-    // (Missing return statement - potential bug)
+    // Value not found
+    return -1;
 }
 
 /*
  * deleteAtPosition - Deletes the node at a specific position (0-indexed)
- * @head: double pointer to the head
+ * @list: the list to delete from
  * @position: the index of node to delete
  * 
  * Returns: data value of deleted node, or -1 if invalid position
  * 
  * Time Complexity: O(n) - must traverse to the position
  */
-int deleteAtPosition(struct Node** head, int position) {
+int deleteAtPosition(List *list, int position) {
     // Case 1: Empty list
-    if (*head == NULL) {
+    if (list->head == NULL) {
         printf("List is empty!\n");
         return -1;
     }
-    
-    struct Node* temp;
-    int deletedVal;
+
+    // The cached size rejects bad positions before any traversal
+    if (position < 0 || position >= list->size) {
+        printf("Position out of range!\n");
+        return -1;
+    }
     
     // Case 2: Delete at position 0 (head)
     if (position == 0) {
-        temp = *head;
-        deletedVal = temp->data;
-        *head = (*head)->Next;           // Move head to second node
-        free(temp);
-        return deletedVal;
+        return deleteFromBeginning(list);
     }
     
     // Case 3: Delete at other positions
-    struct Node* curr = *head;
+    struct Node* curr = list->head;
     
     // Traverse to node just BEFORE target position
     for (int i = 0; i < position - 1; i++) {
-        if (curr->Next == NULL) {        // Check if position is valid
-            printf("Position out of range!\n");
-            return -1;
-        }
         curr = curr->Next;
     }
     
-    // Check if target position exists
-    if (curr->Next == NULL) {
-        printf("Position out of range!\n");
-        return -1;
-    }
-    
     // Delete the node at position
-    temp = curr->Next;                   // Node to delete
-    deletedVal = temp->data;
+    struct Node* temp = curr->Next;      // Node to delete
+    int deletedVal = temp->data;
     curr->Next = temp->Next;             // Bypass deleted node
-    free(temp);
+    if (temp == list->tail)              // Deleted the last node
+        list->tail = curr;
+    indexUnlinked(list, temp, curr);
+    releaseNode(temp);
+    list->size--;
     
     return deletedVal;
 }
 
 /*
  * search - Finds the position of a value in the list
- * @head: pointer to the first node
+ * @list: the list to search
  * @value: the value to search for
  * 
  * Returns: position (0-indexed) if found, -1 if not found
  * 
  * Time Complexity: O(n) - may need to search entire list
+ *                  (a miss is O(1) expected with an index; a hit still
+ *                  walks, since the position has to be counted)
  */
-int search(struct Node* head, int value) {
-    struct Node* curr = head;
+int search(List *list, int value) {
+    if (list->index != NULL && indexFind(list->index, value) == NULL)
+        return -1;
+
+    struct Node* curr = list->head;
     int counter = -1;                    // Will be 0 after first increment
     
     // Traverse the list
@@ -388,7 +1039,6 @@ int search(struct Node* head, int value) {
     {
         counter++;
         if (curr->data == value) {
-            printf("Found it at pos: %d", counter);
             return counter;
         }
         curr = curr->Next;
@@ -398,102 +1048,83 @@ int search(struct Node* head, int value) {
 }
 
 /*
- * getLength - Counts the number of nodes in the list
- * @head: pointer to the first node
+ * getLength - Returns the number of nodes in the list
+ * @list: the list to measure
  * 
  * Returns: the number of nodes in the list
  * 
- * Time Complexity: O(n) - must count every node
+ * Time Complexity: O(1) - the size is kept up to date by every operation
  */
-int getLength(struct Node* head) {
-    struct Node* curr = head;
-    int len = 0;
-    
-    // Traverse and count each node
-    while (curr != NULL)
-    {
-        len++;
-        curr = curr->Next;
-    }
-    return len;
+int getLength(List *list) {
+    return list->size;
 }
 
 /*
  * getElementAt - Retrieves the data at a specific position
- * @head: pointer to the first node
+ * @list: the list to read from
  * @position: the index to retrieve (0-indexed)
  * 
  * Returns: data value at position, or -1 if invalid
  * 
  * Time Complexity: O(n) - must traverse to the position
+ *                  (O(1) for the last position)
  */
-int getElementAt(struct Node* head, int position) {
+int getElementAt(List *list, int position) {
     // Case 1: Empty list
-    if (head == NULL) {
+    if (list->head == NULL) {
         printf("List is empty!\n");
         return -1;
     }
+
+    // Check if position is valid
+    if (position < 0 || position >= list->size) {
+        printf("Position out of range!\n");
+        return -1;
+    }
+
+    // Last element: no traversal needed
+    if (position == list->size - 1) {
+        return list->tail->data;
+    }
     
-    struct Node* curr = head;
+    struct Node* curr = list->head;
     
     // Traverse to the target position
     for (int i = 0; i < position; i++) {
-        if (curr == NULL) {
-            printf("Position out of range!\n");
-            return -1;
-        }
         curr = curr->Next;
     }
-
-    // Check if position is valid
-    if (curr == NULL) {
-        printf("Position out of range!\n");
-        return -1;
-    }
     
     return curr->data;
 }
 
 /*
- * getMiddle - Finds the middle element using the "slow & fast pointer" technique
- * @head: pointer to the first node
+ * getMiddle - Finds the middle element
+ * @list: the list to read from
  * 
  * Returns: data value of middle node, or -1 if empty
  * 
- * Algorithm (Floyd's Tortoise):
- * - slow pointer moves 1 step at a time
- * - fast pointer moves 2 steps at a time
- * - When fast reaches end, slow is at middle
+ * With the size cached, the middle is simply position size / 2; walking
+ * there touches half the nodes, the same as the slow pointer of the
+ * slow & fast pointer technique, without the fast pointer's extra reads.
  * 
- * Time Complexity: O(n) - single pass through list
- * Space Complexity: O(1) - only two pointers
+ * Time Complexity: O(n) - n / 2 steps
+ * Space Complexity: O(1)
  * 
  * For even-length lists, returns the second middle element
  * Example: [1,2,3,4] -> returns 3 (position 2)
  * Example: [1,2,3,4,5] -> returns 3 (position 2)
  */
-int getMiddle(struct Node* head) {
+int getMiddle(List *list) {
     // Empty list check
-    if (head == NULL) {
+    if (list->head == NULL) {
         printf("List is empty!\n");
         return -1;
     }
     
-    struct Node* slow = head;            // Moves 1 node at a time
-    struct Node* fast = head;            // Moves 2 nodes at a time
-
-    // Continue while fast can make two more moves
-    while (fast != NULL && fast->Next != NULL)
+    struct Node* slow = list->head;
+    for (int i = 0; i < list->size / 2; i++)
     {
-        slow = slow->Next;               // Move slow by 1
-        fast = fast->Next->Next;         // Move fast by 2
-    }
-    
-    // This check is redundant since slow starts at head
-    // and only moves if the list has elements
-    if (slow == NULL) {
-        printf("Position out of range!\n");
-        return -1;
+        slow = slow->Next;
     }
 
     return slow->data;                   // slow is now at middle
@@ -501,7 +1132,7 @@ int getMiddle(struct Node* head) {
 
 /*
  * reverseList - Reverses the entire linked list in-place
- * @head: double pointer to the head
+ * @list: the list to reverse
  * 
  * Algorithm: Iteratively reverse the direction of all Next pointers
  * 
@@ -517,11 +1148,14 @@ int getMiddle(struct Node* head) {
  * Step 2:  NULL <- [A] <- [B]     curr -> [C] -> NULL
  * Step 3:  NULL <- [A] <- [B] <- [C]     curr -> NULL
  */
-void reverseList(struct Node** head) {
+void reverseList(List *list) {
     struct Node* prev = NULL;            // Will become the new tail (initially NULL)
-    struct Node* curr = *head;           // Current node being processed
+    struct Node* curr = list->head;      // Current node being processed
     struct Node* next = NULL;            // Temporary storage for next node
 
+    // The old head becomes the new tail
+    list->tail = list->head;
+
     while (curr != NULL)
     {
         // Step 1: Save the next node (before we lose the reference)
@@ -536,54 +1170,8 @@ void reverseList(struct Node** head) {
     }
     
     // prev is now pointing to the last node (new head)
-    *head = prev;
-}
+    list->head = prev;
 
-/*
- * main - Test driver for the singly linked list implementation
- * 
- * Tests performed:
- * 1. Build a list with insertAtEnd
- * 2. Print the list
- * 3. Get length
- * 4. Search for values (existing and non-existing)
- * 5. Find middle element
- * 6. Reverse the list
- * 7. Find middle of reversed list
- */
-int main() {
-    struct Node* head = NULL;            // Local head pointer (shadows global)
-    
-    // Build list: 10 -> 20 -> 30 -> 40 -> 50
-    insertAtEnd(&head, 10);
-    insertAtEnd(&head, 20);
-    insertAtEnd(&head, 30);
-    insertAtEnd(&head, 40);
-    insertAtEnd(&head, 50);
-    
-    printf("Original list: ");
-    printList(head);
-    
-    // Test getLength
-    printf("\nLength: %d\n", getLength(head));
-    
-    // Test search - existing value
-    printf("\nSearch 30: position %d\n", search(head, 30));
-    // Test search - non-existing value
-    printf("Search 99: position %d\n", search(head, 99));
-    
-    // Test getMiddle (for 5 elements, middle is element 3 = 30)
-    printf("\nMiddle element: %d\n", getMiddle(head));
-    
-    // Test reverse
-    printf("\nReversing list...\n");
-    reverseList(&head);
-    printf("Reversed list: ");
-    printList(head);
-    
-    // After reverse: 50 -> 40 -> 30 -> 20 -> 10
-    // Middle is still 30
-    printf("\nMiddle of reversed: %d\n", getMiddle(head));
-    
-    return 0;
-}
\ No newline at end of file
+    // Every predecessor changed
+    rebuildListIndex(list);
+}
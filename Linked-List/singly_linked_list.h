@@ -0,0 +1,132 @@
+#ifndef SINGLY_LINKED_LIST_H
+#define SINGLY_LINKED_LIST_H
+
+/*
+ * Structure definition for a Singly Linked List Node
+ * Each node contains:
+ * - data: the integer value stored in the node
+ * - inSlab: 1 if the node lives inside a NodeSlab (see below) and must not
+ *   be passed to free() on its own; sits in what would be padding anyway
+ * - Next: pointer to the next node in the list (NULL if last node)
+ * 
+ * Unlike doubly linked lists, singly linked lists can only traverse forward
+ */
+struct Node
+{
+    int data;
+    int inSlab;
+    struct Node *Next;
+};
+
+/*
+ * NodeSlab - One allocation holding a whole batch of nodes, already linked
+ * in order (listFromArray / appendArray):
+ * 
+ *   [next | count | node 0 | node 1 | node 2 | ... ]
+ *                    Next ---^  Next ---^
+ * 
+ * A traversal walks consecutive addresses, and building n nodes costs one
+ * malloc instead of n. Deleting a slab node unlinks it but its memory is
+ * only returned when freeList frees the whole slab.
+ */
+struct NodeSlab
+{
+    struct NodeSlab *next;          // other slabs of the same list
+    int count;
+    struct Node nodes[];
+};
+
+/*
+ * ListIndex - Optional hash index over a List (enableListIndex)
+ * 
+ * Open addressing with linear probing, one IndexEntry per distinct value:
+ * the FIRST node holding the value, the node before it (NULL when it is
+ * the head) and how many nodes hold the value. Knowing the predecessor
+ * is what lets deleteByValue unlink in O(1) on a singly linked list.
+ * Every insert and delete path keeps it in sync.
+ */
+typedef struct IndexEntry
+{
+    int key;
+    int count;                      // 0 = empty slot
+    struct Node *node;
+    struct Node *pred;
+} IndexEntry;
+
+typedef struct ListIndex
+{
+    IndexEntry *slots;
+    int capacity;                   // power of two, at most half full
+    int used;
+} ListIndex;
+
+/*
+ * List - Handle for a singly linked list
+ * 
+ * Every operation takes a List * instead of a bare struct Node **head and
+ * keeps all three fields in sync, so the tail and the length are always
+ * known without a traversal:
+ * 
+ *   list -> head -> [A] -> [B] -> [C] -> NULL
+ *           tail ------------------^
+ *           size = 3
+ * 
+ * An empty list is { NULL, NULL, 0, NULL, NULL } (see initList).
+ */
+typedef struct List
+{
+    struct Node *head;
+    struct Node *tail;
+    int size;
+    struct NodeSlab *slabs;         // slabs whose nodes this list owns
+    ListIndex *index;               // NULL unless enableListIndex was called
+} List;
+
+/*
+ * CompactState - Progress of an incremental compaction (compactBegin /
+ * compactStep): nodes before `curr` already live in `arena`, in order
+ */
+typedef struct CompactState
+{
+    struct NodeSlab *arena;         // destination, one slot per element
+    struct Node *prev;              // last relocated node (NULL: none yet)
+    struct Node *curr;              // next node to relocate (NULL: done)
+    int moved;
+} CompactState;
+
+struct Node *CreateNode(int value);
+void initList(List *list);
+void printList(List *list);
+
+void insertAtBeginning(List *list, int value);
+void insertAtEnd(List *list, int value);
+void insertAtPosition(List *list, int value, int position);
+void insertSorted(List *list, int value);
+void appendList(List *list, List *other);
+
+int listFromArray(List *list, const int *values, int count);
+int appendArray(List *list, const int *values, int count);
+int listToArray(List *list, int *values);
+void freeList(List *list);
+
+int enableListIndex(List *list);
+void disableListIndex(List *list);
+void rebuildListIndex(List *list);
+int listContains(List *list, int value);
+
+int compactList(List *list);
+int compactBegin(List *list, CompactState *state);
+int compactStep(List *list, CompactState *state, int maxNodes);
+
+int deleteFromBeginning(List *list);
+int deleteFromEnd(List *list);
+int deleteByValue(List *list, int value);
+int deleteAtPosition(List *list, int position);
+
+int search(List *list, int value);
+int getLength(List *list);
+int getElementAt(List *list, int position);
+int getMiddle(List *list);
+void reverseList(List *list);
+
+#endif
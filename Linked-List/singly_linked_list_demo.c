@@ -0,0 +1,150 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "singly_linked_list.h"
+
+/*
+ * main - Test driver for the singly linked list implementation
+ * 
+ * Tests performed:
+ * 1. Build a list with insertAtEnd
+ * 2. Print the list
+ * 3. Get length
+ * 4. Search for values (existing and non-existing)
+ * 5. Find middle element
+ * 6. Reverse the list
+ * 7. Find middle of reversed list
+ * 8. Splice two lists with appendList, delete at both ends
+ * 9. Build a queue of n elements with insertAtEnd / deleteFromBeginning
+ *    (O(1) each with the tail pointer, so O(n) overall)
+ * 10. Build n elements with n insertAtEnd calls vs one listFromArray
+ *     slab, and time a traversal of each
+ * 
+ * Build: gcc -O2 singly_linked_list.c singly_linked_list_demo.c -o sll
+ * Usage: ./sll [queueSize]
+ */
+int main(int argc, char **argv) {
+    List list;
+    initList(&list);
+    
+    // Build list: 10 -> 20 -> 30 -> 40 -> 50
+    insertAtEnd(&list, 10);
+    insertAtEnd(&list, 20);
+    insertAtEnd(&list, 30);
+    insertAtEnd(&list, 40);
+    insertAtEnd(&list, 50);
+    
+    printf("Original list: ");
+    printList(&list);
+    
+    // Test getLength
+    printf("\nLength: %d\n", getLength(&list));
+    
+    // Test search - existing value
+    printf("\nSearch 30: position %d\n", search(&list, 30));
+    // Test search - non-existing value
+    printf("Search 99: position %d\n", search(&list, 99));
+    
+    // Test getMiddle (for 5 elements, middle is element 3 = 30)
+    printf("\nMiddle element: %d\n", getMiddle(&list));
+    
+    // Test reverse
+    printf("\nReversing list...\n");
+    reverseList(&list);
+    printf("Reversed list: ");
+    printList(&list);
+    
+    // After reverse: 50 -> 40 -> 30 -> 20 -> 10
+    // Middle is still 30
+    printf("\nMiddle of reversed: %d\n", getMiddle(&list));
+
+    // Splice: [50 .. 10] + [1, 2, 3]
+    List other;
+    initList(&other);
+    insertAtEnd(&other, 1);
+    insertAtEnd(&other, 2);
+    insertAtEnd(&other, 3);
+    appendList(&list, &other);
+    printf("\nAfter appendList: ");
+    printList(&list);
+    printf("Length: %d, last: %d, other length: %d\n", getLength(&list),
+           getElementAt(&list, getLength(&list) - 1), getLength(&other));
+
+    deleteFromEnd(&list);
+    deleteByValue(&list, 2);
+    deleteFromBeginning(&list);
+    insertAtPosition(&list, 99, getLength(&list));
+    printf("After deleting 3, 2, 50 and inserting 99 at the end: ");
+    printList(&list);
+    printf("Length: %d, tail: %d\n", getLength(&list), list.tail->data);
+
+    // Queue of queueSize elements
+    int queueSize = (argc > 1) ? atoi(argv[1]) : 10000000;
+    List queue;
+    initList(&queue);
+
+    clock_t start = clock();
+    for (int i = 0; i < queueSize; i++)
+        insertAtEnd(&queue, i);
+    long long sum = 0;
+    while (getLength(&queue) > 0)
+        sum += deleteFromBeginning(&queue);
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("\nQueue of %d: enqueue + dequeue all in %.3f s (sum %lld)\n", queueSize, seconds, sum);
+
+    // Node by node vs one slab
+    int *values = (int *)malloc((size_t)queueSize * sizeof(int));
+    if (values == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+    for (int i = 0; i < queueSize; i++)
+        values[i] = i;
+
+    List single, slab;
+    initList(&single);
+    start = clock();
+    for (int i = 0; i < queueSize; i++)
+        insertAtEnd(&single, values[i]);
+    double singleBuild = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    if (listFromArray(&slab, values, queueSize) != 0)
+    {
+        freeList(&single);
+        free(values);
+        freeList(&list);
+        return 1;
+    }
+    double slabBuild = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    long long singleSum = 0, slabSum = 0;
+    start = clock();
+    for (struct Node *curr = single.head; curr != NULL; curr = curr->Next)
+        singleSum += curr->data;
+    double singleWalk = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    for (struct Node *curr = slab.head; curr != NULL; curr = curr->Next)
+        slabSum += curr->data;
+    double slabWalk = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    int check = listToArray(&slab, values) == queueSize && values[queueSize - 1] == queueSize - 1;
+    printf("\n%d elements      build      traverse\n", queueSize);
+    printf("insertAtEnd     %7.3f s  %7.3f s\n", singleBuild, singleWalk);
+    printf("listFromArray   %7.3f s  %7.3f s   (same sum: %s)\n", slabBuild, slabWalk,
+           singleSum == slabSum && check ? "yes" : "NO");
+
+    start = clock();
+    freeList(&single);
+    double singleFree = (double)(clock() - start) / CLOCKS_PER_SEC;
+    start = clock();
+    freeList(&slab);
+    double slabFree = (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("freeList        %7.3f s vs %.3f s\n", singleFree, slabFree);
+
+    free(values);
+    freeList(&list);
+    return 0;
+}
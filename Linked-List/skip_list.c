@@ -0,0 +1,272 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "skip_list.h"
+
+/*
+ * randomHeight - Geometric tower height: P(height > k) = 4^-k
+ *
+ * Two bits of one xorshift64* draw per level; ctz of the draw counts the
+ * zero bit pairs in a row.
+ */
+static int randomHeight(SkipList *list)
+{
+    unsigned long long x = list->state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    list->state = x;
+    x *= 0x2545F4914F6CDD1DULL;
+
+    int height = 1 + __builtin_ctzll(x | (1ULL << 63)) / 2;
+    return height < SKIP_MAX_LEVEL ? height : SKIP_MAX_LEVEL;
+}
+
+static struct SkipNode *createSkipNode(int value, int height)
+{
+    struct SkipNode *node = (struct SkipNode *)malloc(sizeof(struct SkipNode) +
+                                                      height * sizeof(struct SkipNode *));
+    if (node == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+    node->data = value;
+    node->height = height;
+    for (int level = 0; level < height; level++)
+        node->Next[level] = NULL;
+    return node;
+}
+
+/*
+ * findPredecessors - Fills update[level] with the last node on each level
+ * whose data is < value (the head sentinel if there is none)
+ *
+ * Returns: the first base-level node with data >= value, or NULL
+ */
+static struct SkipNode *findPredecessors(SkipList *list, int value, struct SkipNode **update)
+{
+    struct SkipNode *curr = list->head;
+    for (int level = list->level - 1; level >= 0; level--)
+    {
+        while (curr->Next[level] != NULL && curr->Next[level]->data < value)
+            curr = curr->Next[level];
+        update[level] = curr;
+    }
+    return curr->Next[0];
+}
+
+/*
+ * createSkipList - Makes an empty skip list
+ * @seed: seeds the tower heights (same seed, same shape)
+ *
+ * Returns: pointer to the list, or NULL if allocation failed
+ */
+SkipList *createSkipList(unsigned long long seed)
+{
+    SkipList *list = (SkipList *)malloc(sizeof(SkipList));
+    if (list == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    list->head = createSkipNode(0, SKIP_MAX_LEVEL);
+    if (list->head == NULL)
+    {
+        free(list);
+        return NULL;
+    }
+    list->level = 1;
+    list->size = 0;
+    list->state = seed * 0x9E3779B97F4A7C15ULL + 1;      // xorshift state must be non-zero
+    return list;
+}
+
+void freeSkipList(SkipList *list)
+{
+    if (list == NULL)
+        return;
+
+    struct SkipNode *node = list->head;
+    while (node != NULL)
+    {
+        struct SkipNode *next = node->Next[0];
+        free(node);
+        node = next;
+    }
+    free(list);
+}
+
+/*
+ * skipFromList - Builds a skip list from an already sorted singly list
+ * @sorted: ascending list (e.g. built with insertSorted); left unchanged
+ *
+ * Every value is appended, so no search is needed: last[level] remembers
+ * the current end of each level.
+ *
+ * Returns: the new list, or NULL if allocation failed
+ *
+ * Time Complexity: O(n)
+ */
+SkipList *skipFromList(List *sorted, unsigned long long seed)
+{
+    SkipList *list = createSkipList(seed);
+    if (list == NULL)
+        return NULL;
+
+    struct SkipNode *last[SKIP_MAX_LEVEL];
+    for (int level = 0; level < SKIP_MAX_LEVEL; level++)
+        last[level] = list->head;
+
+    for (struct Node *curr = sorted->head; curr != NULL; curr = curr->Next)
+    {
+        int height = randomHeight(list);
+        struct SkipNode *node = createSkipNode(curr->data, height);
+        if (node == NULL)
+        {
+            freeSkipList(list);
+            return NULL;
+        }
+
+        for (int level = 0; level < height; level++)
+        {
+            last[level]->Next[level] = node;
+            last[level] = node;
+        }
+        if (height > list->level)
+            list->level = height;
+        list->size++;
+    }
+    return list;
+}
+
+/*
+ * skipInsert - Inserts value in ascending order
+ *
+ * Time Complexity: O(log n) expected
+ */
+void skipInsert(SkipList *list, int value)
+{
+    struct SkipNode *update[SKIP_MAX_LEVEL];
+    findPredecessors(list, value, update);
+
+    int height = randomHeight(list);
+    struct SkipNode *node = createSkipNode(value, height);
+    if (node == NULL)
+        return;
+
+    // New top levels start at the head sentinel
+    for (int level = list->level; level < height; level++)
+        update[level] = list->head;
+    if (height > list->level)
+        list->level = height;
+
+    for (int level = 0; level < height; level++)
+    {
+        node->Next[level] = update[level]->Next[level];
+        update[level]->Next[level] = node;
+    }
+    list->size++;
+}
+
+/*
+ * skipDelete - Deletes one occurrence of value
+ *
+ * Returns: the deleted value, or -1 if not found / empty
+ *
+ * Time Complexity: O(log n) expected
+ */
+int skipDelete(SkipList *list, int value)
+{
+    if (list->size == 0)
+    {
+        printf("List is empty!\n");
+        return -1;
+    }
+
+    struct SkipNode *update[SKIP_MAX_LEVEL];
+    struct SkipNode *node = findPredecessors(list, value, update);
+    if (node == NULL || node->data != value)
+        return -1;
+
+    for (int level = 0; level < node->height; level++)
+        update[level]->Next[level] = node->Next[level];
+    free(node);
+
+    while (list->level > 1 && list->head->Next[list->level - 1] == NULL)
+        list->level--;
+    list->size--;
+    return value;
+}
+
+/*
+ * skipSearch - 1 if value is in the list, 0 otherwise
+ *
+ * Unlike search() this does not return a position: counting the
+ * elements skipped would need a width on every link.
+ *
+ * Time Complexity: O(log n) expected
+ */
+int skipSearch(SkipList *list, int value)
+{
+    struct SkipNode *node = skipLowerBound(list, value);
+    return node != NULL && node->data == value;
+}
+
+/*
+ * skipLowerBound - First node with data >= value, or NULL
+ *
+ * Follow Next[0] from the result to iterate in ascending order.
+ *
+ * Time Complexity: O(log n) expected
+ */
+struct SkipNode *skipLowerBound(SkipList *list, int value)
+{
+    struct SkipNode *curr = list->head;
+    for (int level = list->level - 1; level >= 0; level--)
+    {
+        while (curr->Next[level] != NULL && curr->Next[level]->data < value)
+            curr = curr->Next[level];
+    }
+    return curr->Next[0];
+}
+
+/*
+ * skipForEachInRange - Calls visit on every value in [low, high], ascending
+ * @visit: callback, may be NULL to just count; non-zero return stops
+ *
+ * Returns: number of values visited
+ *
+ * Time Complexity: O(log n + k) expected for k values in range
+ */
+long long skipForEachInRange(SkipList *list, int low, int high, SkipVisit visit, void *context)
+{
+    long long visited = 0;
+    for (struct SkipNode *node = skipLowerBound(list, low);
+         node != NULL && node->data <= high; node = node->Next[0])
+    {
+        visited++;
+        if (visit != NULL && visit(node->data, context))
+            break;
+    }
+    return visited;
+}
+
+int getLengthS(SkipList *list)
+{
+    return list->size;
+}
+
+/*
+ * printSkipList - Prints every level, top first
+ */
+void printSkipList(SkipList *list)
+{
+    for (int level = list->level - 1; level >= 0; level--)
+    {
+        printf("L%d: ", level);
+        for (struct SkipNode *node = list->head->Next[level]; node != NULL; node = node->Next[level])
+            printf("%d -> ", node->data);
+        printf("NULL\n");
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include "singly_linked_list.h"
+
+/*
+ * ============================================================================
+ * SKIP LIST
+ * ============================================================================
+ *
+ * The sorted singly list plus "express lanes": every node sits on the base
+ * level (a plain sorted linked list, Next[0]) and on each higher level with
+ * probability 1/4, so level k holds ~n / 4^k nodes:
+ *
+ *   level 2:  head ------------------------> 40 -------------------> NULL
+ *   level 1:  head ------> 20 -------------> 40 ------> 60 --------> NULL
+ *   level 0:  head -> 10 -> 20 -> 30 -> 35 -> 40 -> 50 -> 60 -> 70 -> NULL
+ *
+ * A search starts on the top level of the head sentinel, runs right while
+ * the next value is smaller, and drops a level otherwise: O(log n)
+ * expected steps for search, insert and delete, instead of insertSorted's
+ * O(n) walk.
+ *
+ * Duplicates are allowed; like insertSorted, a new value goes in front of
+ * any equal ones. Range iteration walks the base level from skipLowerBound.
+ * ============================================================================
+ */
+
+#define SKIP_MAX_LEVEL 24           // 4^24 elements before the top level fills up
+
+struct SkipNode
+{
+    int data;
+    int height;                     // levels 0 .. height-1
+    struct SkipNode *Next[];        // Next[0] is the base list
+};
+
+typedef struct SkipList
+{
+    struct SkipNode *head;          // sentinel with SKIP_MAX_LEVEL levels
+    int level;                      // levels in use (>= 1)
+    int size;
+    unsigned long long state;       // tower height generator
+} SkipList;
+
+// Called once per value in [low, high]; return non-zero to stop early
+typedef int (*SkipVisit)(int value, void *context);
+
+SkipList *createSkipList(unsigned long long seed);
+void freeSkipList(SkipList *list);
+SkipList *skipFromList(List *sorted, unsigned long long seed);
+
+void skipInsert(SkipList *list, int value);
+int skipDelete(SkipList *list, int value);
+int skipSearch(SkipList *list, int value);
+struct SkipNode *skipLowerBound(SkipList *list, int value);
+long long skipForEachInRange(SkipList *list, int low, int high, SkipVisit visit, void *context);
+
+int getLengthS(SkipList *list);
+void printSkipList(SkipList *list);
+
+#endif
@@ -0,0 +1,296 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "singly_linked_list.h"
+#include "skip_list.h"
+#include "concurrent_skip_list.h"
+#include "../Graph/parallel.h"
+
+/*
+ * Test driver / benchmark for skip_list.c and concurrent_skip_list.c
+ *
+ * 1. Small demo: levels, search, range
+ * 2. Random insert / delete / search / range checked against a sorted
+ *    singly List
+ * 3. Sorted inserts: insertSorted vs skipInsert, then skipInsert alone at
+ *    full size
+ * 4. Concurrent list: threads insert / delete / search the same key range;
+ *    the per-key net of successful inserts minus deletes must equal the
+ *    final contents
+ *
+ * Build: gcc -O2 -pthread ../Graph/parallel.c singly_linked_list.c skip_list.c concurrent_skip_list.c skip_list_bench.c -o skiplist
+ * Usage: ./skiplist [elements] [threads]
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int nextRandom(unsigned int *state)
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+static int sumVisit(int value, void *context)
+{
+    *(long long *)context += value;
+    return 0;
+}
+
+static int randomCheck(int operations)
+{
+    unsigned int state = 42;
+    List model;
+    initList(&model);
+    SkipList *list = createSkipList(1);
+    int ok = list != NULL;
+
+    for (int step = 0; step < operations && ok; step++)
+    {
+        int value = (int)(nextRandom(&state) % 2000);
+        switch (nextRandom(&state) % 4)
+        {
+        case 0:
+        case 1:
+            insertSorted(&model, value);
+            skipInsert(list, value);
+            break;
+        case 2:
+            if (getLength(&model) > 0)
+                ok = deleteByValue(&model, value) == skipDelete(list, value);
+            break;
+        case 3:
+            ok = (search(&model, value) != -1) == skipSearch(list, value);
+            break;
+        }
+    }
+
+    // Base level == model, and every range sum matches
+    struct Node *curr = model.head;
+    for (struct SkipNode *node = list->head->Next[0]; node != NULL && ok; node = node->Next[0])
+    {
+        ok = curr != NULL && curr->data == node->data;
+        curr = curr->Next;
+    }
+    ok = ok && curr == NULL && getLengthS(list) == getLength(&model);
+
+    for (int low = -10; low < 2010 && ok; low += 37)
+    {
+        int high = low + 150;
+        long long expected = 0, got = 0, count = 0;
+        for (curr = model.head; curr != NULL; curr = curr->Next)
+        {
+            if (curr->data >= low && curr->data <= high)
+            {
+                expected += curr->data;
+                count++;
+            }
+        }
+        ok = skipForEachInRange(list, low, high, sumVisit, &got) == count && got == expected;
+    }
+
+    while (getLength(&model) > 0)
+        deleteFromBeginning(&model);
+    freeSkipList(list);
+    return ok;
+}
+
+typedef struct ConcurrentContext
+{
+    ConcurrentSkipList *list;
+    int keys;
+    int operations;         // per thread
+    int *net;               // [thread][keys]
+    long long found;
+    int failed;             // set when an insert could not allocate
+} ConcurrentContext;
+
+static void concurrentWorker(void *arg, int thread, int threads)
+{
+    (void)threads;
+    ConcurrentContext *context = (ConcurrentContext *)arg;
+    int *net = context->net + (long long)thread * context->keys;
+    unsigned int state = 1000u + thread;
+    long long found = 0;
+
+    for (int i = 0; i < context->operations; i++)
+    {
+        int value = (int)(nextRandom(&state) % context->keys);
+        unsigned int op = nextRandom(&state) % 10;
+        if (op < 3)
+        {
+            int inserted = cslInsert(context->list, value);
+            if (inserted < 0)
+            {
+                __atomic_store_n(&context->failed, 1, __ATOMIC_RELAXED);
+                return;
+            }
+            net[value] += inserted;
+        }
+        else if (op < 5)
+            net[value] -= cslDelete(context->list, value);
+        else
+            found += cslContains(context->list, value);
+    }
+    __atomic_fetch_add(&context->found, found, __ATOMIC_RELAXED);
+}
+
+static int runConcurrent(int keys, int operations, int threads)
+{
+    ConcurrentContext context;
+    context.list = createConcurrentSkipList();
+    context.keys = keys;
+    context.operations = operations / threads;
+    context.net = (int *)calloc((size_t)threads * keys, sizeof(int));
+    context.found = 0;
+    context.failed = 0;
+    if (context.list == NULL || context.net == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        freeConcurrentSkipList(context.list);
+        free(context.net);
+        return 0;
+    }
+
+    // Half full to start with
+    for (int value = 0; value < keys && !context.failed; value += 2)
+    {
+        int inserted = cslInsert(context.list, value);
+        if (inserted < 0)
+            context.failed = 1;
+        else
+            context.net[value] += inserted;
+    }
+
+    double start = nowSeconds();
+    if (!context.failed)
+        parallelRun(threads, concurrentWorker, &context);
+    double seconds = nowSeconds() - start;
+    if (context.failed)
+    {
+        freeConcurrentSkipList(context.list);
+        free(context.net);
+        return 0;
+    }
+
+    int ok = 1, present = 0;
+    for (int value = 0; value < keys && ok; value++)
+    {
+        int total = 0;
+        for (int t = 0; t < threads; t++)
+            total += context.net[(long long)t * keys + value];
+        int contains = cslContains(context.list, value);
+        ok = (total == 0 || total == 1) && total == contains;
+        present += contains;
+    }
+    ok = ok && present == cslSize(context.list) &&
+         cslForEachInRange(context.list, 0, keys, NULL, NULL) == present;
+
+    printf("  %2d threads: %10.1f k ops/s  (%d keys left)  %s\n", threads,
+           context.operations * (double)threads / seconds / 1e3, present, ok ? "OK" : "MISMATCH");
+
+    freeConcurrentSkipList(context.list);
+    free(context.net);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    int elements = (argc > 1) ? atoi(argv[1]) : 1000000;
+    int maxThreads = (argc > 2) ? atoi(argv[2]) : defaultThreadCount();
+
+    // ---- Demo ----
+    SkipList *demo = createSkipList(7);
+    int values[] = {40, 10, 60, 30, 20, 70, 35, 50};
+    for (int i = 0; i < 8; i++)
+        skipInsert(demo, values[i]);
+    printSkipList(demo);
+    long long rangeSum = 0;
+    long long inRange = skipForEachInRange(demo, 20, 50, sumVisit, &rangeSum);
+    printf("search 35: %d, search 36: %d, values in [20, 50]: %lld (sum %lld)\n",
+           skipSearch(demo, 35), skipSearch(demo, 36), inRange, rangeSum);
+    skipDelete(demo, 40);
+    printf("after deleting 40:\n");
+    printSkipList(demo);
+    freeSkipList(demo);
+
+    int ok = randomCheck(20000);
+    printf("\nRandom operations vs sorted List: %s\n", ok ? "OK" : "FAILED");
+
+    // ---- insertSorted vs skipInsert ----
+    int small = elements < 40000 ? elements : 40000;
+    printf("\n%-28s %12s %12s\n", "random sorted inserts", "insertSorted", "skipInsert");
+    for (int n = small / 4; n <= small; n *= 2)
+    {
+        unsigned int state = 5;
+        List sorted;
+        initList(&sorted);
+        double start = nowSeconds();
+        for (int i = 0; i < n; i++)
+            insertSorted(&sorted, (int)nextRandom(&state));
+        double listTime = nowSeconds() - start;
+
+        state = 5;
+        SkipList *list = createSkipList(3);
+        start = nowSeconds();
+        for (int i = 0; i < n; i++)
+            skipInsert(list, (int)nextRandom(&state));
+        double skipTime = nowSeconds() - start;
+
+        SkipList *copy = skipFromList(&sorted, 3);
+        struct SkipNode *a = list->head->Next[0];
+        struct SkipNode *b = copy->head->Next[0];
+        while (a != NULL && b != NULL && a->data == b->data)
+        {
+            a = a->Next[0];
+            b = b->Next[0];
+        }
+        ok = ok && a == NULL && b == NULL;
+
+        printf("  n = %-22d %10.3f s %10.4f s\n", n, listTime, skipTime);
+        freeSkipList(list);
+        freeSkipList(copy);
+        while (getLength(&sorted) > 0)
+            deleteFromBeginning(&sorted);
+    }
+
+    unsigned int state = 9;
+    SkipList *big = createSkipList(11);
+    double start = nowSeconds();
+    for (int i = 0; i < elements; i++)
+        skipInsert(big, (int)nextRandom(&state));
+    double insertTime = nowSeconds() - start;
+
+    state = 9;
+    int hits = 0;
+    start = nowSeconds();
+    for (int i = 0; i < elements; i++)
+        hits += skipSearch(big, (int)nextRandom(&state));
+    double searchTime = nowSeconds() - start;
+
+    start = nowSeconds();
+    long long scanned = skipForEachInRange(big, 0, 1 << 30, NULL, NULL);
+    double rangeTime = nowSeconds() - start;
+    ok = ok && hits == elements && scanned == elements;
+
+    printf("\n%d elements, %d levels: insert %.3f s, search %.3f s (%.0f ns each), full range %.3f s\n",
+           elements, big->level, insertTime, searchTime, searchTime / elements * 1e9, rangeTime);
+    freeSkipList(big);
+
+    // ---- Concurrent ----
+    int operations = elements < 2000000 ? elements : 2000000;
+    printf("\nLock-free skip list, %d mixed ops (30%% insert, 20%% delete, 50%% search) on 65536 keys\n",
+           operations);
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+        ok = runConcurrent(65536, operations, threads) && ok;
+    if (maxThreads < 4)
+        ok = runConcurrent(65536, operations, 4) && ok;   // oversubscribed: still exercises the races
+
+    printf("\n%s\n", ok ? "All checks OK" : "CHECK FAILED");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,509 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "unrolled_linked_list.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/*
+ * createUNode - Allocates an empty node on a cache-line boundary
+ */
+static struct UNode *createUNode(void)
+{
+    struct UNode *node = (struct UNode *)aligned_alloc(64, sizeof(struct UNode));
+    if (node == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    node->Next = NULL;
+    node->count = 0;
+    return node;
+}
+
+/*
+ * findInNode - Index of the first slot equal to value, or -1
+ *
+ * SSE2: four slots are compared per instruction and movemask turns the
+ * result into a bit per slot; the lowest set bit is the first match.
+ */
+static int findInNode(const struct UNode *node, int value)
+{
+    int i = 0;
+#if defined(__SSE2__)
+    __m128i key = _mm_set1_epi32(value);
+    for (; i + 4 <= node->count; i += 4)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(node->data + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, key)));
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+#endif
+    for (; i < node->count; i++)
+    {
+        if (node->data[i] == value)
+            return i;
+    }
+    return -1;
+}
+
+/*
+ * locate - Node holding element `position` (0 <= position < size)
+ * @index: out, slot of the element inside the node
+ * @prev: out, the node before it (NULL for the head)
+ *
+ * Whole nodes are skipped using their counts.
+ */
+static struct UNode *locate(UnrolledList *list, int position, int *index, struct UNode **prev)
+{
+    struct UNode *node = list->head;
+    *prev = NULL;
+
+    while (position >= node->count)
+    {
+        position -= node->count;
+        *prev = node;
+        node = node->Next;
+    }
+
+    *index = position;
+    return node;
+}
+
+/*
+ * insertInNode - Puts value at data[index] of node, splitting it first
+ * if it is full: the upper half moves to a new node linked right after
+ */
+static void insertInNode(UnrolledList *list, struct UNode *node, int index, int value)
+{
+    if (node->count == UNROLLED_CAPACITY)
+    {
+        int keep = (UNROLLED_CAPACITY + 1) / 2;
+        struct UNode *split = createUNode();
+
+        split->count = UNROLLED_CAPACITY - keep;
+        memcpy(split->data, node->data + keep, split->count * sizeof(int));
+        node->count = keep;
+
+        split->Next = node->Next;
+        node->Next = split;
+        if (list->tail == node)
+            list->tail = split;
+        list->nodes++;
+
+        if (index > keep)
+        {
+            node = split;
+            index -= keep;
+        }
+    }
+
+    memmove(node->data + index + 1, node->data + index, (node->count - index) * sizeof(int));
+    node->data[index] = value;
+    node->count++;
+    list->size++;
+}
+
+/*
+ * fixUnderflow - Restores the fill invariant after a removal from node
+ *
+ *   empty node            -> unlinked and freed
+ *   under half full       -> merged with the next node if both fit,
+ *                            otherwise elements are borrowed from it
+ *   the tail node may stay under half full (there is nothing after it)
+ */
+static void fixUnderflow(UnrolledList *list, struct UNode *prev, struct UNode *node)
+{
+    if (node->count == 0)
+    {
+        if (prev == NULL)
+            list->head = node->Next;
+        else
+            prev->Next = node->Next;
+        if (list->tail == node)
+            list->tail = prev;
+        free(node);
+        list->nodes--;
+        return;
+    }
+
+    struct UNode *next = node->Next;
+    if (node->count >= UNROLLED_MIN_FILL || next == NULL)
+        return;
+
+    if (node->count + next->count <= UNROLLED_CAPACITY)
+    {
+        memcpy(node->data + node->count, next->data, next->count * sizeof(int));
+        node->count += next->count;
+        node->Next = next->Next;
+        if (list->tail == next)
+            list->tail = node;
+        free(next);
+        list->nodes--;
+    }
+    else
+    {
+        int borrow = UNROLLED_MIN_FILL - node->count;
+        memcpy(node->data + node->count, next->data, borrow * sizeof(int));
+        memmove(next->data, next->data + borrow, (next->count - borrow) * sizeof(int));
+        node->count += borrow;
+        next->count -= borrow;
+    }
+}
+
+/*
+ * removeFromNode - Removes data[index] of node and rebalances
+ *
+ * Returns: the removed value
+ */
+static int removeFromNode(UnrolledList *list, struct UNode *prev, struct UNode *node, int index)
+{
+    int value = node->data[index];
+    memmove(node->data + index, node->data + index + 1, (node->count - index - 1) * sizeof(int));
+    node->count--;
+    list->size--;
+    fixUnderflow(list, prev, node);
+    return value;
+}
+
+/*
+ * initListU - Makes an empty list
+ */
+void initListU(UnrolledList *list)
+{
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->nodes = 0;
+}
+
+/*
+ * freeListU - Frees every node and leaves the list empty
+ *
+ * Time Complexity: O(n / UNROLLED_MIN_FILL)
+ */
+void freeListU(UnrolledList *list)
+{
+    struct UNode *node = list->head;
+    while (node != NULL)
+    {
+        struct UNode *next = node->Next;
+        free(node);
+        node = next;
+    }
+    initListU(list);
+}
+
+/*
+ * printListU - Prints in the same format as printList
+ */
+void printListU(UnrolledList *list)
+{
+    printf("LL elements: ");
+    for (struct UNode *node = list->head; node != NULL; node = node->Next)
+    {
+        for (int i = 0; i < node->count; i++)
+            printf("%d -> ", node->data[i]);
+    }
+    printf("NULL\n");
+}
+
+/*
+ * insertAtBeginningU - Inserts value before the first element
+ *
+ * A full head node is not split: a fresh node is put in front, so a run
+ * of prepends fills nodes completely.
+ *
+ * Time Complexity: O(UNROLLED_CAPACITY)
+ */
+void insertAtBeginningU(UnrolledList *list, int value)
+{
+    if (list->head == NULL || list->head->count == UNROLLED_CAPACITY)
+    {
+        struct UNode *node = createUNode();
+        node->Next = list->head;
+        list->head = node;
+        if (list->tail == NULL)
+            list->tail = node;
+        list->nodes++;
+    }
+    insertInNode(list, list->head, 0, value);
+}
+
+/*
+ * insertAtEndU - Inserts value after the last element
+ *
+ * Time Complexity: O(1)
+ */
+void insertAtEndU(UnrolledList *list, int value)
+{
+    if (list->tail == NULL || list->tail->count == UNROLLED_CAPACITY)
+    {
+        struct UNode *node = createUNode();
+        if (list->tail == NULL)
+            list->head = node;
+        else
+            list->tail->Next = node;
+        list->tail = node;
+        list->nodes++;
+    }
+
+    list->tail->data[list->tail->count++] = value;
+    list->size++;
+}
+
+/*
+ * insertAtPositionU - Inserts value so that it ends up at `position`
+ * (0 = beginning, size = end)
+ *
+ * Time Complexity: O(n / UNROLLED_MIN_FILL) node hops + O(UNROLLED_CAPACITY)
+ */
+void insertAtPositionU(UnrolledList *list, int value, int position)
+{
+    if (position < 0 || position > list->size)
+    {
+        printf("Position out of range!\n");
+        return;
+    }
+    if (position == 0)
+    {
+        insertAtBeginningU(list, value);
+        return;
+    }
+    if (position == list->size)
+    {
+        insertAtEndU(list, value);
+        return;
+    }
+
+    int index;
+    struct UNode *prev;
+    struct UNode *node = locate(list, position, &index, &prev);
+    insertInNode(list, node, index, value);
+}
+
+/*
+ * insertSortedU - Inserts value in ascending order
+ *
+ * Hops to the first node whose last element is >= value (comparing one
+ * element per node), then binary searches inside it.
+ *
+ * Time Complexity: O(n / UNROLLED_MIN_FILL + UNROLLED_CAPACITY)
+ */
+void insertSortedU(UnrolledList *list, int value)
+{
+    if (list->head == NULL || list->tail->data[list->tail->count - 1] < value)
+    {
+        insertAtEndU(list, value);
+        return;
+    }
+
+    struct UNode *node = list->head;
+    while (node->data[node->count - 1] < value)
+        node = node->Next;
+
+    // First slot with data >= value
+    int low = 0, high = node->count - 1;
+    while (low < high)
+    {
+        int mid = low + (high - low) / 2;
+        if (node->data[mid] < value)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    insertInNode(list, node, low, value);
+}
+
+/*
+ * deleteFromBeginningU - Removes and returns the first element
+ *
+ * Returns: the value, or -1 if the list is empty
+ *
+ * Time Complexity: O(UNROLLED_CAPACITY)
+ */
+int deleteFromBeginningU(UnrolledList *list)
+{
+    if (list->head == NULL)
+    {
+        printf("List is empty!\n");
+        return -1;
+    }
+    return removeFromNode(list, NULL, list->head, 0);
+}
+
+/*
+ * deleteFromEndU - Removes and returns the last element
+ *
+ * Returns: the value, or -1 if the list is empty
+ *
+ * Time Complexity: O(1), except when the tail node empties: then the new
+ *                  tail is found by a walk over the nodes
+ */
+int deleteFromEndU(UnrolledList *list)
+{
+    if (list->tail == NULL)
+    {
+        printf("List is empty!\n");
+        return -1;
+    }
+
+    struct UNode *tail = list->tail;
+    int value = tail->data[--tail->count];
+    list->size--;
+
+    if (tail->count == 0)
+    {
+        struct UNode *prev = NULL;
+        if (list->head != tail)
+        {
+            prev = list->head;
+            while (prev->Next != tail)
+                prev = prev->Next;
+        }
+        fixUnderflow(list, prev, tail);
+    }
+    return value;
+}
+
+/*
+ * deleteByValueU - Deletes the first element equal to value
+ *
+ * Returns: the deleted value, or -1 if not found / empty
+ *
+ * Time Complexity: O(n), 4 comparisons per SSE2 instruction
+ */
+int deleteByValueU(UnrolledList *list, int value)
+{
+    if (list->head == NULL)
+    {
+        printf("List is empty!\n");
+        return -1;
+    }
+
+    struct UNode *prev = NULL;
+    for (struct UNode *node = list->head; node != NULL; prev = node, node = node->Next)
+    {
+        int index = findInNode(node, value);
+        if (index != -1)
+            return removeFromNode(list, prev, node, index);
+    }
+    return -1;
+}
+
+/*
+ * deleteAtPositionU - Deletes the element at `position`
+ *
+ * Returns: the deleted value, or -1 if the position is invalid
+ *
+ * Time Complexity: O(n / UNROLLED_MIN_FILL) node hops + O(UNROLLED_CAPACITY)
+ */
+int deleteAtPositionU(UnrolledList *list, int position)
+{
+    if (list->head == NULL)
+    {
+        printf("List is empty!\n");
+        return -1;
+    }
+    if (position < 0 || position >= list->size)
+    {
+        printf("Position out of range!\n");
+        return -1;
+    }
+
+    int index;
+    struct UNode *prev;
+    struct UNode *node = locate(list, position, &index, &prev);
+    return removeFromNode(list, prev, node, index);
+}
+
+/*
+ * searchU - Position of the first element equal to value, or -1
+ *
+ * Time Complexity: O(n), 4 comparisons per SSE2 instruction
+ */
+int searchU(UnrolledList *list, int value)
+{
+    int before = 0;
+    for (struct UNode *node = list->head; node != NULL; node = node->Next)
+    {
+        int index = findInNode(node, value);
+        if (index != -1)
+            return before + index;
+        before += node->count;
+    }
+    return -1;
+}
+
+int getLengthU(UnrolledList *list)
+{
+    return list->size;
+}
+
+/*
+ * getElementAtU - Value at `position`, or -1 if the position is invalid
+ *
+ * Time Complexity: O(n / UNROLLED_MIN_FILL) node hops
+ */
+int getElementAtU(UnrolledList *list, int position)
+{
+    if (list->head == NULL)
+    {
+        printf("List is empty!\n");
+        return -1;
+    }
+    if (position < 0 || position >= list->size)
+    {
+        printf("Position out of range!\n");
+        return -1;
+    }
+
+    int index;
+    struct UNode *prev;
+    struct UNode *node = locate(list, position, &index, &prev);
+    return node->data[index];
+}
+
+/*
+ * getMiddleU - Element at size / 2 (the second middle for even sizes)
+ */
+int getMiddleU(UnrolledList *list)
+{
+    if (list->head == NULL)
+    {
+        printf("List is empty!\n");
+        return -1;
+    }
+    return getElementAtU(list, list->size / 2);
+}
+
+/*
+ * reverseListU - Reverses the node chain and each node's array
+ *
+ * Time Complexity: O(n)
+ */
+void reverseListU(UnrolledList *list)
+{
+    struct UNode *prev = NULL;
+    struct UNode *curr = list->head;
+    list->tail = list->head;
+
+    while (curr != NULL)
+    {
+        for (int i = 0, j = curr->count - 1; i < j; i++, j--)
+        {
+            int temp = curr->data[i];
+            curr->data[i] = curr->data[j];
+            curr->data[j] = temp;
+        }
+
+        struct UNode *next = curr->Next;
+        curr->Next = prev;
+        prev = curr;
+        curr = next;
+    }
+    list->head = prev;
+}
@@ -0,0 +1,67 @@
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+/*
+ * ============================================================================
+ * UNROLLED LINKED LIST
+ * ============================================================================
+ *
+ * Same interface as singly_linked_list.h (every function carries a U
+ * suffix, like the D suffix of doubly_linked_list.c), but each node holds
+ * up to UNROLLED_CAPACITY ints in an array:
+ *
+ *   head -> [ 10 20 30 .. | count ] -> [ 70 80 .. | count ] -> NULL
+ *
+ * A node is exactly two 64-byte cache lines (8-byte Next + 4-byte count +
+ * 29 ints) and is allocated 64-byte aligned, so a scan costs one miss per
+ * ~29 elements instead of one per element, and a position lookup skips
+ * whole nodes using their counts.
+ *
+ *   - insert into a full node splits it into two half-full nodes
+ *     (appends / prepends at a full end node start a new node instead,
+ *     so sequential builds pack nodes completely)
+ *   - delete that leaves a node under half full borrows from, or merges
+ *     with, the next node
+ *   - search inside a node compares 4 ints per instruction (SSE2)
+ * ============================================================================
+ */
+
+#define UNROLLED_CAPACITY 29
+#define UNROLLED_MIN_FILL (UNROLLED_CAPACITY / 2)
+
+struct UNode
+{
+    struct UNode *Next;
+    int count;                      // used slots: data[0 .. count-1]
+    int data[UNROLLED_CAPACITY];
+};
+
+typedef struct UnrolledList
+{
+    struct UNode *head;
+    struct UNode *tail;
+    int size;                       // elements, not nodes
+    int nodes;
+} UnrolledList;
+
+void initListU(UnrolledList *list);
+void freeListU(UnrolledList *list);
+void printListU(UnrolledList *list);
+
+void insertAtBeginningU(UnrolledList *list, int value);
+void insertAtEndU(UnrolledList *list, int value);
+void insertAtPositionU(UnrolledList *list, int value, int position);
+void insertSortedU(UnrolledList *list, int value);
+
+int deleteFromBeginningU(UnrolledList *list);
+int deleteFromEndU(UnrolledList *list);
+int deleteByValueU(UnrolledList *list, int value);
+int deleteAtPositionU(UnrolledList *list, int position);
+
+int searchU(UnrolledList *list, int value);
+int getLengthU(UnrolledList *list);
+int getElementAtU(UnrolledList *list, int position);
+int getMiddleU(UnrolledList *list);
+void reverseListU(UnrolledList *list);
+
+#endif
@@ -0,0 +1,303 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "singly_linked_list.h"
+#include "unrolled_linked_list.h"
+
+/*
+ * Test driver / benchmark for unrolled_linked_list.c
+ *
+ * 1. Small demo, same steps as singly_linked_list_demo.c
+ * 2. Random operations checked against a plain array after every step
+ *    (also checks size, node fill and the tail pointer)
+ * 3. Timings against the singly List: build, indexed reads, search,
+ *    insert in the middle
+ *
+ * Build: gcc -O2 singly_linked_list.c unrolled_linked_list.c unrolled_linked_list_bench.c -o unrolled
+ * Usage: ./unrolled [elements] [operations]
+ */
+
+static unsigned int state = 12345;
+
+static int randomInt(int bound)
+{
+    state = state * 1103515245u + 12345u;
+    return (int)((state >> 8) % (unsigned int)bound);
+}
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * matchesModel - Compares the list with model[0 .. size-1] and checks
+ * the node invariants
+ */
+static int matchesModel(UnrolledList *list, const int *model, int size)
+{
+    if (list->size != size)
+        return 0;
+
+    int position = 0, nodes = 0;
+    struct UNode *last = NULL;
+    for (struct UNode *node = list->head; node != NULL; node = node->Next)
+    {
+        if (node->count < 1 || node->count > UNROLLED_CAPACITY)
+            return 0;
+        if (node->Next != NULL && node->count < UNROLLED_MIN_FILL && node != list->head)
+            return 0;
+        for (int i = 0; i < node->count; i++)
+        {
+            if (node->data[i] != model[position++])
+                return 0;
+        }
+        last = node;
+        nodes++;
+    }
+    return position == size && last == list->tail && nodes == list->nodes;
+}
+
+static int randomCheck(int operations)
+{
+    int capacity = operations + 1;
+    int *model = (int *)malloc(capacity * sizeof(int));
+    if (model == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return 0;
+    }
+
+    UnrolledList list;
+    initListU(&list);
+    int size = 0;
+
+    for (int step = 0; step < operations; step++)
+    {
+        int op = randomInt(size < 200 ? 6 : 9);     // grow while small
+        int value = randomInt(1000);
+        int position, expected = -1, got = -1;
+
+        switch (op)
+        {
+        case 0:
+            insertAtBeginningU(&list, value);
+            memmove(model + 1, model, size * sizeof(int));
+            model[0] = value;
+            size++;
+            break;
+        case 1:
+            insertAtEndU(&list, value);
+            model[size++] = value;
+            break;
+        case 2:
+        case 3:
+            position = randomInt(size + 1);
+            insertAtPositionU(&list, value, position);
+            memmove(model + position + 1, model + position, (size - position) * sizeof(int));
+            model[position] = value;
+            size++;
+            break;
+        case 4:
+            expected = -1;
+            for (int i = 0; i < size; i++)
+            {
+                if (model[i] == value)
+                {
+                    expected = i;
+                    break;
+                }
+            }
+            got = searchU(&list, value);
+            break;
+        case 5:
+            if (size == 0)
+                break;
+            position = randomInt(size);
+            expected = model[position];
+            got = getElementAtU(&list, position);
+            break;
+        case 6:
+            if (size == 0)
+                break;
+            position = randomInt(size);
+            expected = model[position];
+            got = deleteAtPositionU(&list, position);
+            memmove(model + position, model + position + 1, (size - position - 1) * sizeof(int));
+            size--;
+            break;
+        case 7:
+            if (size == 0)
+                break;
+            if (randomInt(2))
+            {
+                expected = model[0];
+                got = deleteFromBeginningU(&list);
+                memmove(model, model + 1, (size - 1) * sizeof(int));
+            }
+            else
+            {
+                expected = model[size - 1];
+                got = deleteFromEndU(&list);
+            }
+            size--;
+            break;
+        case 8:
+            position = -1;
+            for (int i = 0; i < size; i++)
+            {
+                if (model[i] == value)
+                {
+                    position = i;
+                    break;
+                }
+            }
+            expected = position == -1 ? -1 : value;
+            got = deleteByValueU(&list, value);
+            if (position != -1)
+            {
+                memmove(model + position, model + position + 1, (size - position - 1) * sizeof(int));
+                size--;
+            }
+            break;
+        }
+
+        if (got != expected || !matchesModel(&list, model, size))
+        {
+            printf("  MISMATCH at step %d (op %d)\n", step, op);
+            freeListU(&list);
+            free(model);
+            return 0;
+        }
+    }
+
+    // Sorted inserts and reverse
+    freeListU(&list);
+    size = 0;
+    for (int i = 0; i < operations / 4; i++)
+    {
+        int value = randomInt(100000);
+        insertSortedU(&list, value);
+        int position = size;
+        while (position > 0 && model[position - 1] >= value)
+            position--;
+        memmove(model + position + 1, model + position, (size - position) * sizeof(int));
+        model[position] = value;
+        size++;
+    }
+    int ok = matchesModel(&list, model, size);
+
+    reverseListU(&list);
+    for (int i = 0, j = size - 1; i < j; i++, j--)
+    {
+        int temp = model[i];
+        model[i] = model[j];
+        model[j] = temp;
+    }
+    ok = ok && matchesModel(&list, model, size) && getMiddleU(&list) == model[size / 2];
+
+    freeListU(&list);
+    free(model);
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    int elements = (argc > 1) ? atoi(argv[1]) : 100000;
+    int operations = (argc > 2) ? atoi(argv[2]) : 200000;
+
+    // ---- Demo ----
+    UnrolledList demo;
+    initListU(&demo);
+    for (int value = 10; value <= 50; value += 10)
+        insertAtEndU(&demo, value);
+    printf("Original list: ");
+    printListU(&demo);
+    printf("Length: %d, search 30: %d, search 99: %d, middle: %d\n",
+           getLengthU(&demo), searchU(&demo, 30), searchU(&demo, 99), getMiddleU(&demo));
+    reverseListU(&demo);
+    printf("Reversed list: ");
+    printListU(&demo);
+    freeListU(&demo);
+
+    printf("\nRandom operations vs array model (%d ops): ", operations);
+    int ok = randomCheck(operations);
+    printf("%s\n", ok ? "OK" : "FAILED");
+
+    // ---- Timings ----
+    int lookups = 20000;
+    printf("\n%d elements (%d ints per node), %d lookups\n", elements, UNROLLED_CAPACITY, lookups);
+    printf("%-26s %12s %12s\n", "", "singly", "unrolled");
+
+    List singly;
+    UnrolledList unrolled;
+    initList(&singly);
+    initListU(&unrolled);
+
+    double start = nowSeconds();
+    for (int i = 0; i < elements; i++)
+        insertAtEnd(&singly, i);
+    double singlyTime = nowSeconds() - start;
+    start = nowSeconds();
+    for (int i = 0; i < elements; i++)
+        insertAtEndU(&unrolled, i);
+    double unrolledTime = nowSeconds() - start;
+    printf("%-26s %10.4f s %10.4f s\n", "build (insertAtEnd)", singlyTime, unrolledTime);
+
+    long long singlySum = 0, unrolledSum = 0;
+    state = 99;
+    start = nowSeconds();
+    for (int i = 0; i < lookups; i++)
+        singlySum += getElementAt(&singly, randomInt(elements));
+    singlyTime = nowSeconds() - start;
+    state = 99;
+    start = nowSeconds();
+    for (int i = 0; i < lookups; i++)
+        unrolledSum += getElementAtU(&unrolled, randomInt(elements));
+    unrolledTime = nowSeconds() - start;
+    printf("%-26s %10.4f s %10.4f s\n", "getElementAt (random)", singlyTime, unrolledTime);
+    ok = ok && singlySum == unrolledSum;
+
+    int searches = lookups / 10;
+    state = 7;
+    start = nowSeconds();
+    for (int i = 0; i < searches; i++)
+        singlySum += search(&singly, randomInt(elements));
+    singlyTime = nowSeconds() - start;
+    state = 7;
+    start = nowSeconds();
+    for (int i = 0; i < searches; i++)
+        unrolledSum += searchU(&unrolled, randomInt(elements));
+    unrolledTime = nowSeconds() - start;
+    printf("%-26s %10.4f s %10.4f s\n", "search (random value)", singlyTime, unrolledTime);
+    ok = ok && singlySum == unrolledSum;
+
+    state = 3;
+    start = nowSeconds();
+    for (int i = 0; i < lookups; i++)
+        insertAtPosition(&singly, -i, randomInt(getLength(&singly) + 1));
+    singlyTime = nowSeconds() - start;
+    state = 3;
+    start = nowSeconds();
+    for (int i = 0; i < lookups; i++)
+        insertAtPositionU(&unrolled, -i, randomInt(getLengthU(&unrolled) + 1));
+    unrolledTime = nowSeconds() - start;
+    printf("%-26s %10.4f s %10.4f s\n", "insertAtPosition (random)", singlyTime, unrolledTime);
+
+    for (int i = 0; i < getLength(&singly) && ok; i += 997)
+        ok = getElementAt(&singly, i) == getElementAtU(&unrolled, i);
+
+    long long singlyBytes = (long long)getLength(&singly) * sizeof(struct Node);
+    long long unrolledBytes = (long long)unrolled.nodes * sizeof(struct UNode);
+    printf("%-26s %10.1f MB %9.1f MB  (%d nodes)\n", "node memory",
+           singlyBytes / 1e6, unrolledBytes / 1e6, unrolled.nodes);
+    printf("same contents: %s\n", ok ? "OK" : "MISMATCH");
+
+    freeListU(&unrolled);
+    while (getLength(&singly) > 0)
+        deleteFromBeginning(&singly);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,378 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "xor_linked_list.h"
+
+/*
+ * allocNodeX - Takes a node from the freelist, or the next unused slot of
+ * the newest block (adding a block when it is full)
+ *
+ * Returns: the node with data set and link 0, or NULL if allocation failed
+ */
+static struct XNode *allocNodeX(XorList *list, int value)
+{
+    struct XNode *node = list->freeNodes;
+    if (node != NULL)
+        list->freeNodes = (struct XNode *)node->link;
+    else
+    {
+        if (list->blocks == NULL || list->blockUsed == XOR_BLOCK_NODES)
+        {
+            struct XNodeBlock *block = (struct XNodeBlock *)malloc(
+                sizeof(struct XNodeBlock) + XOR_BLOCK_NODES * sizeof(struct XNode));
+            if (block == NULL)
+            {
+                printf("Memory allocation failed!\n");
+                return NULL;
+            }
+            block->next = list->blocks;
+            list->blocks = block;
+            list->blockUsed = 0;
+        }
+        node = &list->blocks->nodes[list->blockUsed++];
+    }
+    node->data = value;
+    node->link = 0;
+    return node;
+}
+
+/*
+ * releaseNodeX - Puts an unlinked node on the freelist
+ */
+static void releaseNodeX(XorList *list, struct XNode *node)
+{
+    node->link = (uintptr_t)list->freeNodes;
+    list->freeNodes = node;
+}
+
+/*
+ * xorNext - The neighbour of curr on the side away from `from`
+ * @from: the node we arrived from (NULL at either end)
+ * @curr: the current node
+ *
+ * Walking forward, from is the previous node; walking backward it is the
+ * next one.
+ */
+struct XNode *xorNext(struct XNode *from, struct XNode *curr)
+{
+    return (struct XNode *)(curr->link ^ (uintptr_t)from);
+}
+
+/*
+ * initListX - Makes an empty list: no head, no tail, size 0, no blocks
+ */
+void initListX(XorList *list)
+{
+    list->head = NULL;
+    list->tail = NULL;
+    list->size = 0;
+    list->blockUsed = 0;
+    list->freeNodes = NULL;
+    list->blocks = NULL;
+}
+
+/*
+ * freeListX - Frees every block and leaves the list empty
+ *
+ * Time Complexity: O(n / XOR_BLOCK_NODES)
+ */
+void freeListX(XorList *list)
+{
+    struct XNodeBlock *block = list->blocks;
+    while (block != NULL)
+    {
+        struct XNodeBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    initListX(list);
+}
+
+/*
+ * printWalk - Prints the list starting from one end
+ */
+static void printWalk(const char *label, struct XNode *start)
+{
+    printf("%s: ", label);
+    struct XNode *from = NULL;
+    for (struct XNode *curr = start; curr != NULL;)
+    {
+        printf("%d <-> ", curr->data);
+        struct XNode *next = xorNext(from, curr);
+        from = curr;
+        curr = next;
+    }
+    printf("NULL\n");
+}
+
+/*
+ * printForwardX - "Forward: val1 <-> val2 <-> ... <-> NULL", as printForward
+ */
+void printForwardX(XorList *list)
+{
+    printWalk("Forward", list->head);
+}
+
+/*
+ * printBackwardX - Same walk started from the tail
+ */
+void printBackwardX(XorList *list)
+{
+    printWalk("Backward", list->tail);
+}
+
+/*
+ * insertAtBeginningX - Inserts a new node at the start of the list
+ *
+ * The new head's link is just &oldHead (0 ^ &oldHead); the old head's
+ * link gains &new (its prev was NULL = 0).
+ *
+ * Time Complexity: O(1)
+ */
+void insertAtBeginningX(XorList *list, int value)
+{
+    struct XNode *node = allocNodeX(list, value);
+    if (node == NULL)
+        return;
+
+    node->link = (uintptr_t)list->head;
+    if (list->head != NULL)
+        list->head->link ^= (uintptr_t)node;
+    else
+        list->tail = node;
+    list->head = node;
+    list->size++;
+}
+
+/*
+ * insertAtEndX - Inserts a new node at the end of the list
+ *
+ * Time Complexity: O(1) - mirror image of insertAtBeginningX
+ */
+void insertAtEndX(XorList *list, int value)
+{
+    struct XNode *node = allocNodeX(list, value);
+    if (node == NULL)
+        return;
+
+    node->link = (uintptr_t)list->tail;
+    if (list->tail != NULL)
+        list->tail->link ^= (uintptr_t)node;
+    else
+        list->head = node;
+    list->tail = node;
+    list->size++;
+}
+
+/*
+ * insertAtPositionX - Inserts a new node at a specific position (0-indexed)
+ * @position: 0 .. size (size appends)
+ *
+ * Walks from whichever end is closer, so at most size / 2 steps.
+ *
+ * Time Complexity: O(min(position, size - position))
+ *
+ * Example: Insert at position 2 in list [A, B, C, D]
+ * Result: [A, B, NEW, C, D]
+ */
+void insertAtPositionX(XorList *list, int value, int position)
+{
+    if (position < 0 || position > list->size)
+    {
+        printf("Position out of range!\n");
+        return;
+    }
+    if (position == 0)
+    {
+        insertAtBeginningX(list, value);
+        return;
+    }
+    if (position == list->size)
+    {
+        insertAtEndX(list, value);
+        return;
+    }
+
+    // Find the neighbours `before` (position - 1) and `after` (position)
+    struct XNode *before, *after;
+    if (position <= list->size / 2)
+    {
+        before = NULL;
+        after = list->head;
+        for (int i = 0; i < position; i++)
+        {
+            struct XNode *next = xorNext(before, after);
+            before = after;
+            after = next;
+        }
+    }
+    else
+    {
+        after = NULL;
+        before = list->tail;
+        for (int i = list->size; i > position; i--)
+        {
+            struct XNode *next = xorNext(after, before);
+            after = before;
+            before = next;
+        }
+    }
+
+    struct XNode *node = allocNodeX(list, value);
+    if (node == NULL)
+        return;
+
+    // before: x ^ after -> x ^ node;  after: before ^ y -> node ^ y
+    node->link = (uintptr_t)before ^ (uintptr_t)after;
+    before->link ^= (uintptr_t)after ^ (uintptr_t)node;
+    after->link ^= (uintptr_t)before ^ (uintptr_t)node;
+    list->size++;
+}
+
+/*
+ * deleteFromBeginningX - Removes the first node from the list
+ *
+ * Returns: the data value of the deleted node, or -1 if list is empty
+ *
+ * Time Complexity: O(1)
+ */
+int deleteFromBeginningX(XorList *list)
+{
+    if (list->head == NULL)
+    {
+        printf("List is empty!\n");
+        return -1;
+    }
+
+    struct XNode *temp = list->head;
+    int deletedval = temp->data;
+    struct XNode *next = xorNext(NULL, temp);
+    if (next != NULL)
+        next->link ^= (uintptr_t)temp;      // its prev becomes NULL
+    else
+        list->tail = NULL;
+    list->head = next;
+    list->size--;
+    releaseNodeX(list, temp);
+    return deletedval;
+}
+
+/*
+ * deleteFromEndX - Removes the last node from the list
+ *
+ * Returns: the data value of the deleted node, or -1 if list is empty
+ *
+ * Time Complexity: O(1)
+ */
+int deleteFromEndX(XorList *list)
+{
+    if (list->tail == NULL)
+    {
+        printf("List is empty!\n");
+        return -1;
+    }
+
+    struct XNode *temp = list->tail;
+    int deletedval = temp->data;
+    struct XNode *prev = xorNext(NULL, temp);
+    if (prev != NULL)
+        prev->link ^= (uintptr_t)temp;      // its next becomes NULL
+    else
+        list->head = NULL;
+    list->tail = prev;
+    list->size--;
+    releaseNodeX(list, temp);
+    return deletedval;
+}
+
+/*
+ * deleteByValueX - Searches for and deletes the first node with matching value
+ *
+ * Returns: the deleted value, or -1 if not found/empty
+ *
+ * Time Complexity: O(n) - may need to search entire list
+ */
+int deleteByValueX(XorList *list, int value)
+{
+    if (list->head == NULL)
+    {
+        printf("List is empty!\n");
+        return -1;
+    }
+
+    struct XNode *prev = NULL;
+    struct XNode *curr = list->head;
+    while (curr != NULL && curr->data != value)
+    {
+        struct XNode *next = xorNext(prev, curr);
+        prev = curr;
+        curr = next;
+    }
+
+    if (curr == NULL)
+    {
+        printf("Value %d not found!\n", value);
+        return -1;
+    }
+
+    // Each neighbour swaps curr for the other neighbour in its link
+    struct XNode *next = xorNext(prev, curr);
+    if (prev != NULL)
+        prev->link ^= (uintptr_t)curr ^ (uintptr_t)next;
+    else
+        list->head = next;
+    if (next != NULL)
+        next->link ^= (uintptr_t)curr ^ (uintptr_t)prev;
+    else
+        list->tail = prev;
+
+    list->size--;
+    releaseNodeX(list, curr);
+    return value;
+}
+
+/*
+ * searchX - Finds the position of a value in the list
+ *
+ * Returns: position (0-indexed) if found, -1 if not found
+ *
+ * Time Complexity: O(n)
+ */
+int searchX(XorList *list, int value)
+{
+    struct XNode *prev = NULL;
+    int position = 0;
+    for (struct XNode *curr = list->head; curr != NULL; position++)
+    {
+        if (curr->data == value)
+            return position;
+        struct XNode *next = xorNext(prev, curr);
+        prev = curr;
+        curr = next;
+    }
+    return -1;
+}
+
+/*
+ * getLengthX - Returns the number of nodes in the list
+ *
+ * Time Complexity: O(1) - unlike getLengthD, the size is cached
+ */
+int getLengthX(XorList *list)
+{
+    return list->size;
+}
+
+/*
+ * reverseListX - Reverses the list
+ *
+ * A link reads the same in both directions, so no node changes: the tail
+ * simply becomes the head.
+ *
+ * Time Complexity: O(1) (reverseDLL swaps prev / next in every node)
+ */
+void reverseListX(XorList *list)
+{
+    struct XNode *temp = list->head;
+    list->head = list->tail;
+    list->tail = temp;
+}
@@ -0,0 +1,79 @@
+#ifndef XOR_LINKED_LIST_H
+#define XOR_LINKED_LIST_H
+
+#include <stdint.h>
+
+/*
+ * ============================================================================
+ * XOR-LINKED LIST
+ * ============================================================================
+ *
+ * The doubly linked list of doubly_linked_list.c (every function carries
+ * an X suffix, like its D suffix) with ONE link field per node instead of
+ * prev and next:
+ *
+ *   link = address(prev) XOR address(next)       (NULL counts as 0)
+ *
+ *            [A]            [B]            [C]
+ *   link:  0 ^ &B        &A ^ &C        &B ^ 0
+ *
+ * Knowing where you came from gives where to go: next = link ^ prev, and
+ * the same rule walks backwards from the tail. Both ends are O(1), and
+ * reversing is just swapping head and tail.
+ *
+ *   struct DNode: 4 data + 4 padding + 8 prev + 8 next = 24 bytes
+ *   struct XNode: 4 data + 4 padding + 8 link          = 16 bytes
+ *
+ * malloc would round both up to the same 32-byte chunk, so nodes are
+ * carved from blocks of XOR_BLOCK_NODES and recycled through a freelist;
+ * that way a node really costs 16 bytes.
+ *
+ * The price: a node pointer alone is not enough to move (its neighbour is
+ * needed too), so there is no O(1) delete of an arbitrary node given only
+ * its address.
+ * ============================================================================
+ */
+
+#define XOR_BLOCK_NODES 1024
+
+struct XNode
+{
+    int data;
+    uintptr_t link;                 // prev ^ next
+};
+
+struct XNodeBlock
+{
+    struct XNodeBlock *next;
+    struct XNode nodes[];
+};
+
+typedef struct XorList
+{
+    struct XNode *head;
+    struct XNode *tail;
+    int size;
+    int blockUsed;                  // nodes handed out from blocks (newest block)
+    struct XNode *freeNodes;        // recycled, chained through link
+    struct XNodeBlock *blocks;
+} XorList;
+
+void initListX(XorList *list);
+void freeListX(XorList *list);
+struct XNode *xorNext(struct XNode *from, struct XNode *curr);
+void printForwardX(XorList *list);
+void printBackwardX(XorList *list);
+
+void insertAtBeginningX(XorList *list, int value);
+void insertAtEndX(XorList *list, int value);
+void insertAtPositionX(XorList *list, int value, int position);
+
+int deleteFromBeginningX(XorList *list);
+int deleteFromEndX(XorList *list);
+int deleteByValueX(XorList *list, int value);
+
+int searchX(XorList *list, int value);
+int getLengthX(XorList *list);
+void reverseListX(XorList *list);
+
+#endif
@@ -0,0 +1,305 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <malloc.h>
+#include <time.h>
+#include "xor_linked_list.h"
+
+/*
+ * Test driver / benchmark for xor_linked_list.c
+ *
+ * 1. The doubly_linked_list.c demo, replayed on an XorList
+ * 2. Random mix of every operation against an array; after each step the
+ *    forward and the backward walk must both match it
+ * 3. n elements as struct DNode (one malloc per node, as CreateNode does)
+ *    vs XorList: heap bytes per element (mallinfo2) and forward / backward
+ *    traversal time
+ *
+ * doubly_linked_list.c has its own main, so struct DNode is repeated here
+ * with the same layout instead of being linked in.
+ *
+ * Build: gcc -O2 xor_linked_list.c xor_linked_list_bench.c -o xorlist
+ * Usage: ./xorlist [elements]
+ */
+
+struct DNode
+{
+    int data;
+    struct DNode *prev;
+    struct DNode *next;
+};
+
+static unsigned int state = 5050;
+
+static int randomInt(int bound)
+{
+    state = state * 1103515245u + 12345u;
+    return (int)((state >> 8) % (unsigned int)bound);
+}
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t heapInUse(void)
+{
+    return mallinfo2().uordblks;
+}
+
+/*
+ * sameAsArray - 1 if both walks of list spell out values[0 .. n-1]
+ */
+static int sameAsArray(XorList *list, const int *values, int n)
+{
+    if (getLengthX(list) != n)
+        return 0;
+
+    struct XNode *from = NULL, *curr = list->head;
+    for (int i = 0; i < n; i++)
+    {
+        if (curr == NULL || curr->data != values[i])
+            return 0;
+        struct XNode *next = xorNext(from, curr);
+        from = curr;
+        curr = next;
+    }
+    if (curr != NULL || from != list->tail)
+        return 0;
+
+    from = NULL;
+    curr = list->tail;
+    for (int i = n - 1; i >= 0; i--)
+    {
+        if (curr == NULL || curr->data != values[i])
+            return 0;
+        struct XNode *next = xorNext(from, curr);
+        from = curr;
+        curr = next;
+    }
+    return curr == NULL && from == list->head;
+}
+
+static int randomCheck(int steps)
+{
+    enum { CAPACITY = 4096 };
+    static int values[CAPACITY];
+    int n = 0;
+    XorList list;
+    initListX(&list);
+
+    for (int step = 0; step < steps; step++)
+    {
+        int op = randomInt(n < CAPACITY - 1 ? 9 : 6);
+        int value = randomInt(512);
+        if (n == 0 && op < 6)
+            op = 6;
+
+        switch (op)
+        {
+        case 0:
+            if (deleteFromBeginningX(&list) != values[0])
+                return 0;
+            for (int i = 1; i < n; i++)
+                values[i - 1] = values[i];
+            n--;
+            break;
+        case 1:
+            if (deleteFromEndX(&list) != values[--n])
+                return 0;
+            break;
+        case 2:
+        case 3:
+        {
+            // Delete a value that is present (deleteByValueX prints misses);
+            // it must take out the first occurrence
+            value = values[randomInt(n)];
+            int at = 0;
+            while (values[at] != value)
+                at++;
+            if (deleteByValueX(&list, value) != value)
+                return 0;
+            for (int i = at + 1; i < n; i++)
+                values[i - 1] = values[i];
+            n--;
+            break;
+        }
+        case 4:
+        {
+            reverseListX(&list);
+            for (int i = 0, j = n - 1; i < j; i++, j--)
+            {
+                int temp = values[i];
+                values[i] = values[j];
+                values[j] = temp;
+            }
+            break;
+        }
+        case 5:
+        {
+            int at = randomInt(n);
+            int first = -1;
+            for (int i = 0; i < n && first < 0; i++)
+                first = (values[i] == values[at]) ? i : -1;
+            if (searchX(&list, values[at]) != first)
+                return 0;
+            break;
+        }
+        case 6:
+            insertAtBeginningX(&list, value);
+            for (int i = n; i > 0; i--)
+                values[i] = values[i - 1];
+            values[0] = value;
+            n++;
+            break;
+        case 7:
+            insertAtEndX(&list, value);
+            values[n++] = value;
+            break;
+        default:
+        {
+            int position = randomInt(n + 1);
+            insertAtPositionX(&list, value, position);
+            for (int i = n; i > position; i--)
+                values[i] = values[i - 1];
+            values[position] = value;
+            n++;
+            break;
+        }
+        }
+
+        if (!sameAsArray(&list, values, n))
+            return 0;
+    }
+    freeListX(&list);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    int n = (argc > 1) ? atoi(argv[1]) : 10000000;
+
+    // ---- Demo (same steps as doubly_linked_list.c) ----
+    XorList list;
+    initListX(&list);
+    for (int value = 10; value <= 50; value += 10)
+        insertAtEndX(&list, value);
+    printf("Original list:\n");
+    printForwardX(&list);
+    printf("Length: %d\n", getLengthX(&list));
+    printf("\nInsert 25 at position 2:\n");
+    insertAtPositionX(&list, 25, 2);
+    printForwardX(&list);
+    deleteByValueX(&list, 30);
+    deleteByValueX(&list, 10);
+    deleteByValueX(&list, 50);
+    printf("\nAfter deleting 30, 10 (first) and 50 (last):\n");
+    printForwardX(&list);
+    printf("\nReverse the list:\n");
+    reverseListX(&list);
+    printForwardX(&list);
+    printBackwardX(&list);
+    freeListX(&list);
+
+    int ok = randomCheck(20000);
+    printf("\nRandom check (20000 operations, both directions): %s\n", ok ? "OK" : "FAILED");
+
+    // ---- Memory: DNode per malloc vs XorList blocks ----
+    size_t before = heapInUse();
+    struct DNode *head = NULL, *tail = NULL;
+    double start = nowSeconds();
+    for (int i = 0; i < n; i++)
+    {
+        struct DNode *node = (struct DNode *)malloc(sizeof(struct DNode));
+        if (node == NULL)
+        {
+            printf("Memory allocation failed!\n");
+            return 1;
+        }
+        node->data = i;
+        node->prev = tail;
+        node->next = NULL;
+        if (tail != NULL)
+            tail->next = node;
+        else
+            head = node;
+        tail = node;
+    }
+    double dnodeBuild = nowSeconds() - start;
+    double dnodeBytes = (double)(heapInUse() - before) / n;
+
+    before = heapInUse();
+    start = nowSeconds();
+    initListX(&list);
+    for (int i = 0; i < n; i++)
+        insertAtEndX(&list, i);
+    double xorBuild = nowSeconds() - start;
+    double xorBytes = (double)(heapInUse() - before) / n;
+
+    // ---- Traversal, best of 5 ----
+    double dnodeForward = 1e9, dnodeBackward = 1e9, xorForward = 1e9, xorBackward = 1e9;
+    long long expected = (long long)n * (n - 1) / 2;
+    for (int round = 0; round < 5; round++)
+    {
+        long long sum = 0;
+        start = nowSeconds();
+        for (struct DNode *curr = head; curr != NULL; curr = curr->next)
+            sum += curr->data;
+        double seconds = nowSeconds() - start;
+        dnodeForward = seconds < dnodeForward ? seconds : dnodeForward;
+        ok = ok && sum == expected;
+
+        sum = 0;
+        start = nowSeconds();
+        for (struct DNode *curr = tail; curr != NULL; curr = curr->prev)
+            sum += curr->data;
+        seconds = nowSeconds() - start;
+        dnodeBackward = seconds < dnodeBackward ? seconds : dnodeBackward;
+        ok = ok && sum == expected;
+
+        // Inline xorNext: the DNode loops above are inline too
+        sum = 0;
+        start = nowSeconds();
+        for (struct XNode *from = NULL, *curr = list.head; curr != NULL;)
+        {
+            sum += curr->data;
+            struct XNode *next = (struct XNode *)(curr->link ^ (uintptr_t)from);
+            from = curr;
+            curr = next;
+        }
+        seconds = nowSeconds() - start;
+        xorForward = seconds < xorForward ? seconds : xorForward;
+        ok = ok && sum == expected;
+
+        sum = 0;
+        start = nowSeconds();
+        for (struct XNode *from = NULL, *curr = list.tail; curr != NULL;)
+        {
+            sum += curr->data;
+            struct XNode *next = (struct XNode *)(curr->link ^ (uintptr_t)from);
+            from = curr;
+            curr = next;
+        }
+        seconds = nowSeconds() - start;
+        xorBackward = seconds < xorBackward ? seconds : xorBackward;
+        ok = ok && sum == expected;
+    }
+
+    printf("\n%d elements     bytes/elem   build      forward    backward\n", n);
+    printf("struct DNode      %5.1f    %7.3f s  %7.3f s  %7.3f s\n", dnodeBytes, dnodeBuild,
+           dnodeForward, dnodeBackward);
+    printf("XorList           %5.1f    %7.3f s  %7.3f s  %7.3f s\n", xorBytes, xorBuild,
+           xorForward, xorBackward);
+
+    while (head != NULL)
+    {
+        struct DNode *next = head->next;
+        free(head);
+        head = next;
+    }
+    freeListX(&list);
+
+    printf("\n%s\n", ok ? "All checks OK" : "CHECK FAILED");
+    return ok ? 0 : 1;
+}
@@ -42,6 +42,11 @@ int getBalance(AVL_Tree *node)
     return BF;
 }
 
+int max(int a, int b)
+{
+    return (a > b) ? a : b;
+}
+
 AVL_Tree *rightRotate(AVL_Tree *z)
 {
 
@@ -65,11 +70,6 @@ AVL_Tree *rightRotate(AVL_Tree *z)
     return y;
 }
 
-int max(int a, int b)
-{
-    return (a > b) ? a : b;
-}
-
 AVL_Tree *leftRotate(AVL_Tree *z)
 {
     // Your code here
@@ -212,4 +212,141 @@ AVL_Tree *delete(AVL_Tree *node, int value)
     if (bf < -1 && getBalance(node->right) > 0)
         return RL_Rotate(node);
     return node;
-}
\ No newline at end of file
+}
+
+void freeTree(AVL_Tree *node)
+{
+    if (node == NULL)
+        return;
+    freeTree(node->left);
+    freeTree(node->right);
+    free(node);
+}
+
+/*
+ * buildAVL - sortedArrayToAVL's recursion; sets *failed and frees the
+ * partial subtree when a node cannot be allocated
+ */
+static AVL_Tree *buildAVL(const int *sorted, long long low, long long high, int *failed)
+{
+    if (low > high)
+        return NULL;
+
+    long long mid = low + (high - low) / 2;
+    AVL_Tree *node = createNode(sorted[mid]);
+    if (node == NULL)
+    {
+        *failed = 1;
+        return NULL;
+    }
+
+    node->left = buildAVL(sorted, low, mid - 1, failed);
+    if (!*failed)
+        node->right = buildAVL(sorted, mid + 1, high, failed);
+    if (*failed)
+    {
+        freeTree(node);
+        return NULL;
+    }
+    node->height = max(getHeight(node->left), getHeight(node->right)) + 1;
+
+    return node;
+}
+
+/*
+ * sortedArrayToAVL - Builds an AVL tree from an ascending array
+ * @sorted: ascending values (e.g. the output of Tree/Heap/external_sort.c)
+ * @low, @high: inclusive index range to build from
+ *
+ * Splitting at the middle gives subtrees whose heights differ by at most
+ * one, so every balance factor is already in [-1, 1] and no rotation is
+ * needed. Heights are filled in on the way back up.
+ *
+ * Returns: the root, or NULL if the range is empty or allocation failed
+ *          (a partly built tree is freed, never returned truncated)
+ *
+ * Time Complexity: O(n) instead of O(n log n) for n calls to insert
+ */
+AVL_Tree *sortedArrayToAVL(const int *sorted, long long low, long long high)
+{
+    int failed = 0;
+    return buildAVL(sorted, low, high, &failed);
+}
+
+/*
+ * checkAVL - Verifies the AVL invariants of a subtree in order
+ * @expected: the values the in-order walk must produce, from *next on
+ * @next: in/out, index of the next expected value
+ *
+ * Every stored height must match the real one and every balance factor
+ * must be in [-1, 1].
+ *
+ * Returns: the subtree's height, or -1 if anything is wrong
+ */
+int checkAVL(AVL_Tree *node, const int *expected, long long *next)
+{
+    if (node == NULL)
+        return 0;
+
+    int left = checkAVL(node->left, expected, next);
+    if (left < 0 || node->data != expected[(*next)++])
+        return -1;
+    int right = checkAVL(node->right, expected, next);
+    if (right < 0)
+        return -1;
+
+    int bf = left - right;
+    if (bf < -1 || bf > 1 || node->height != max(left, right) + 1)
+        return -1;
+    return node->height;
+}
+
+/*
+ * Driver: ./avl [n]
+ *
+ * Bulk-loads 0, 3, 6, ... (n values) with sortedArrayToAVL, checks it
+ * with checkAVL, and does the same for a tree built by n inserts.
+ *
+ * Build: gcc -O2 AVL_Tree.c -o avl
+ */
+int main(int argc, char **argv)
+{
+    long long n = (argc > 1) ? atoll(argv[1]) : 1000000;
+    if (n < 0)
+        n = 0;
+
+    int *sorted = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    if (sorted == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+    for (long long i = 0; i < n; i++)
+        sorted[i] = (int)(3 * i);
+
+    AVL_Tree *bulk = sortedArrayToAVL(sorted, 0, n - 1);
+    long long next = 0;
+    int bulkHeight = (bulk == NULL && n > 0) ? -1 : checkAVL(bulk, sorted, &next);
+    int bulkOk = bulkHeight >= 0 && next == n;
+    printf("sortedArrayToAVL: %lld values, height %d, balance / heights / in-order: %s\n",
+           n, bulkHeight, bulkOk ? "OK" : "FAILED");
+    if (bulk == NULL && n > 0)
+    {
+        free(sorted);
+        return 1;
+    }
+
+    AVL_Tree *inserted = NULL;
+    for (long long i = 0; i < n; i++)
+        inserted = insert(inserted, sorted[i]);
+    next = 0;
+    int insertHeight = checkAVL(inserted, sorted, &next);
+    int insertOk = insertHeight >= 0 && next == n;
+    printf("insert (sorted) : %lld values, height %d, balance / heights / in-order: %s\n",
+           n, insertHeight, insertOk ? "OK" : "FAILED");
+
+    freeTree(bulk);
+    freeTree(inserted);
+    free(sorted);
+    return (bulkOk && insertOk) ? 0 : 1;
+}
@@ -1,5 +1,9 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 typedef struct Node
 {
@@ -238,6 +242,18 @@ int countNodes(Node *root)
     return leftcnt + rightcnt + 1;
 }
 
+// Free entire tree (use postorder!)
+void freeTree(Node *root)
+{
+    if (root == NULL)
+    {
+        return;
+    }
+    freeTree(root->left);
+    freeTree(root->right);
+    free(root);
+}
+
 Node* findMin(Node* root){
     if(root==NULL)
     {
@@ -304,6 +320,77 @@ Node* deleteNode(Node* root, int val) {
     return root;
 }
 
+/*
+ * sortedArrayToBST - Builds a height-balanced BST from an ascending array
+ * @sorted: ascending values (e.g. the output of Tree/Heap/external_sort.c)
+ * @low, @high: inclusive index range to build from
+ *
+ * The middle element becomes the root, each half becomes a subtree.
+ * No comparisons are needed and the height is ceil(log2(n + 1)).
+ *
+ * Time Complexity: O(n), recursion depth O(log n)
+ */
+Node *sortedArrayToBST(const int *sorted, long long low, long long high)
+{
+    if (low > high)
+    {
+        return NULL;
+    }
+
+    long long mid = low + (high - low) / 2;
+    Node *root = createNode(sorted[mid]);
+    root->left = sortedArrayToBST(sorted, low, mid - 1);
+    root->right = sortedArrayToBST(sorted, mid + 1, high);
+
+    return root;
+}
+
+/*
+ * loadSortedFile - Builds a balanced BST straight from a sorted binary
+ * int file by mmapping it, without copying it into an array first
+ *
+ * Returns: the tree root, or NULL if the file is empty or unreadable
+ */
+Node *loadSortedFile(const char *path, long long *count)
+{
+    *count = 0;
+
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        perror(path);
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1)
+    {
+        perror(path);
+        close(fd);
+        return NULL;
+    }
+    long long n = st.st_size / sizeof(int);
+    if (n == 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    const int *sorted = (const int *)mmap(NULL, n * sizeof(int), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (sorted == MAP_FAILED)
+    {
+        perror("mmap");
+        return NULL;
+    }
+
+    Node *root = sortedArrayToBST(sorted, 0, n - 1);
+    munmap((void *)sorted, n * sizeof(int));
+
+    *count = n;
+    return root;
+}
+
 // int main(void)
 // {
 //     Node *root = createNode(20);
@@ -366,9 +453,20 @@ Node* deleteNode(Node* root, int val) {
 // }
 
 
-int main(void) {
+int main(int argc, char **argv) {
     Node *root = NULL;
 
+    // ./bst sorted.bin : bulk-load a file produced by external_sort
+    if (argc > 1) {
+        long long count;
+        root = loadSortedFile(argv[1], &count);
+        printf("Loaded %lld sorted values from %s\n", count, argv[1]);
+        printf("Tree Height: %d\n", height(root));
+        printf("Min: %d\n", root != NULL ? findMin(root)->data : -1);
+        freeTree(root);
+        return 0;
+    }
+
     root = insert(root, 20);
     root = insert(root, 10);
     root = insert(root, 30);
@@ -404,5 +502,6 @@ int main(void) {
     
     printf("\nFinal count: %d\n", countNodes(root));
 
+    freeTree(root);
     return 0;
 }
\ No newline at end of file
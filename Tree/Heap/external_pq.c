@@ -0,0 +1,460 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "external_pq.h"
+
+#define WINDOW_ITEMS ((long long)(EXTPQ_WINDOW_BYTES / sizeof(HeapItem)))
+
+static int compareHeapItems(const void *a, const void *b)
+{
+    long long x = ((const HeapItem *)a)->key;
+    long long y = ((const HeapItem *)b)->key;
+    return (x > y) - (x < y);
+}
+
+/*
+ * createTempFile - Opens a fresh temp file and unlinks it right away,
+ * so the kernel reclaims the space as soon as the fd is closed
+ *
+ * Returns: file descriptor, or -1 on failure
+ */
+static int createTempFile(ExternalPQ *pq)
+{
+    char path[300];
+    snprintf(path, sizeof(path), "%s/extpq-XXXXXX", pq->tempDir);
+
+    int fd = mkstemp(path);
+    if (fd == -1)
+    {
+        perror("mkstemp");
+        return -1;
+    }
+    unlink(path);
+
+    return fd;
+}
+
+/*
+ * writeAll - write() until every byte is out (write may be partial)
+ */
+static int writeAll(int fd, const void *buffer, size_t bytes)
+{
+    const char *p = (const char *)buffer;
+
+    while (bytes > 0)
+    {
+        ssize_t written = write(fd, p, bytes);
+        if (written <= 0)
+        {
+            perror("write");
+            return -1;
+        }
+        p += written;
+        bytes -= written;
+    }
+
+    return 0;
+}
+
+/*
+ * prefetchRun - Keeps the mapping one window ahead of the reader
+ *
+ * Called when run->pos lands on a window boundary: the window just
+ * consumed is dropped from the page cache and the window after the
+ * current one is requested, so reads stay sequential and resident
+ * memory per run stays at about two windows.
+ */
+static void prefetchRun(SpillRun *run)
+{
+    if (run->pos >= WINDOW_ITEMS)
+    {
+        size_t offset = (run->pos - WINDOW_ITEMS) * sizeof(HeapItem);
+        madvise((char *)run->items + offset, EXTPQ_WINDOW_BYTES, MADV_DONTNEED);
+    }
+
+    while (run->prefetched < run->length && run->prefetched < run->pos + 2 * WINDOW_ITEMS)
+    {
+        size_t offset = run->prefetched * sizeof(HeapItem);
+        size_t bytes = EXTPQ_WINDOW_BYTES;
+        if (offset + bytes > run->mappedBytes)
+            bytes = run->mappedBytes - offset;
+
+        madvise((char *)run->items + offset, bytes, MADV_WILLNEED);
+        run->prefetched += WINDOW_ITEMS;
+    }
+}
+
+/*
+ * openRun - mmaps a finished run file into run
+ * @fd: file holding length sorted HeapItems
+ *
+ * Returns: 0 on success, -1 on failure (fd is closed on failure)
+ */
+static int openRun(SpillRun *run, int fd, long long length)
+{
+    run->mappedBytes = length * sizeof(HeapItem);
+    void *map = mmap(NULL, run->mappedBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED)
+    {
+        perror("mmap");
+        close(fd);
+        return -1;
+    }
+    madvise(map, run->mappedBytes, MADV_SEQUENTIAL);
+
+    run->fd = fd;
+    run->items = (HeapItem *)map;
+    run->length = length;
+    run->pos = 0;
+    run->prefetched = 0;
+    prefetchRun(run);
+    return 0;
+}
+
+/*
+ * mapRun - mmaps a finished run file into a free slot and registers its head
+ *
+ * Returns: 0 on success, -1 on failure (fd is closed either way on failure)
+ */
+static int mapRun(ExternalPQ *pq, int fd, long long length)
+{
+    int slot = 0;
+    while (slot < EXTPQ_MAX_RUNS && pq->runs[slot].items != NULL)
+        slot++;
+
+    if (openRun(&pq->runs[slot], fd, length) != 0)
+        return -1;
+
+    heapPush(pq->runHeads, pq->runs[slot].items[0].key, slot);
+    pq->runCount++;
+
+    return 0;
+}
+
+static void closeRun(ExternalPQ *pq, SpillRun *run)
+{
+    munmap(run->items, run->mappedBytes);
+    close(run->fd);
+    run->items = NULL;
+    pq->runCount--;
+}
+
+/*
+ * popFromRuns - Removes the smallest run head
+ *
+ * Time Complexity: O(log R) for R live runs
+ */
+static void popFromRuns(ExternalPQ *pq, HeapItem *out)
+{
+    int slot = heapTop(pq->runHeads).value;
+    SpillRun *run = &pq->runs[slot];
+
+    *out = run->items[run->pos];
+    run->pos++;
+
+    if (run->pos < run->length)
+    {
+        if (run->pos % WINDOW_ITEMS == 0)
+            prefetchRun(run);
+        heapReplaceTop(pq->runHeads, run->items[run->pos].key, slot);
+    }
+    else
+    {
+        HeapItem done;
+        heapPop(pq->runHeads, &done);
+        closeRun(pq, run);
+    }
+}
+
+typedef struct RunRemaining
+{
+    long long remaining;
+    int slot;
+} RunRemaining;
+
+static int compareRemaining(const void *a, const void *b)
+{
+    long long x = ((const RunRemaining *)a)->remaining;
+    long long y = ((const RunRemaining *)b)->remaining;
+    return (x > y) - (x < y);
+}
+
+/*
+ * mergeRuns - Merges the EXTPQ_MERGE_RUNS shortest runs into one
+ *
+ * Size-tiered: only runs with the fewest unread items are merged, so a
+ * big run produced by an earlier merge is left alone until enough runs of
+ * its size have piled up. Every item is rewritten O(log N / log
+ * EXTPQ_MERGE_RUNS) times in total instead of once per merge.
+ *
+ * The sources are only read (through local cursors) until the new run is
+ * written and mapped; then they are closed and the run-heads heap is
+ * rebuilt. On failure the queue is exactly as before.
+ *
+ * Output goes through one window-sized buffer, so the merge is a
+ * sequential read of the chosen runs and a sequential write of the result.
+ */
+static int mergeRuns(ExternalPQ *pq)
+{
+    RunRemaining live[EXTPQ_MAX_RUNS];
+    int liveCount = 0;
+    for (int slot = 0; slot < EXTPQ_MAX_RUNS; slot++)
+    {
+        SpillRun *run = &pq->runs[slot];
+        if (run->items != NULL)
+        {
+            live[liveCount].remaining = run->length - run->pos;
+            live[liveCount].slot = slot;
+            liveCount++;
+        }
+    }
+    qsort(live, liveCount, sizeof(RunRemaining), compareRemaining);
+
+    int k = liveCount < EXTPQ_MERGE_RUNS ? liveCount : EXTPQ_MERGE_RUNS;
+    long long cursor[EXTPQ_MERGE_RUNS];
+    Heap *heads = createHeap(k);
+    HeapItem *buffer = (HeapItem *)malloc(EXTPQ_WINDOW_BYTES);
+    if (heads == NULL || buffer == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        freeHeap(heads);
+        free(buffer);
+        return -1;
+    }
+
+    int fd = createTempFile(pq);
+    if (fd == -1)
+    {
+        freeHeap(heads);
+        free(buffer);
+        return -1;
+    }
+
+    for (int i = 0; i < k; i++)
+    {
+        SpillRun *run = &pq->runs[live[i].slot];
+        cursor[i] = run->pos;
+        heapPush(heads, run->items[run->pos].key, i);
+    }
+
+    long long total = 0;
+    long long buffered = 0;
+    int status = 0;
+    while (!heapIsEmpty(heads) && status == 0)
+    {
+        int i = heapTop(heads).value;
+        SpillRun *run = &pq->runs[live[i].slot];
+        buffer[buffered++] = run->items[cursor[i]++];
+        if (cursor[i] < run->length)
+            heapReplaceTop(heads, run->items[cursor[i]].key, i);
+        else
+        {
+            HeapItem done;
+            heapPop(heads, &done);
+        }
+
+        if (buffered == WINDOW_ITEMS || heapIsEmpty(heads))
+        {
+            status = writeAll(fd, buffer, buffered * sizeof(HeapItem));
+            total += buffered;
+            buffered = 0;
+        }
+    }
+    freeHeap(heads);
+    free(buffer);
+
+    SpillRun merged;
+    if (status != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    if (openRun(&merged, fd, total) != 0)
+        return -1;
+
+    // Commit: retire the sources, put the merged run in the first one's slot
+    for (int i = 0; i < k; i++)
+        closeRun(pq, &pq->runs[live[i].slot]);
+    pq->runs[live[0].slot] = merged;
+    pq->runCount++;
+    pq->mergedItems += total;
+
+    pq->runHeads->size = 0;
+    for (int slot = 0; slot < EXTPQ_MAX_RUNS; slot++)
+    {
+        SpillRun *run = &pq->runs[slot];
+        if (run->items != NULL)
+            heapPush(pq->runHeads, run->items[run->pos].key, slot);
+    }
+
+    return 0;
+}
+
+/*
+ * spill - Sorts the memory heap, writes it out as a run and empties it
+ */
+static int spill(ExternalPQ *pq)
+{
+    if (pq->runCount == EXTPQ_MAX_RUNS && mergeRuns(pq) != 0)
+        return -1;
+
+    Heap *memory = pq->memory;
+    qsort(memory->array, memory->size, sizeof(HeapItem), compareHeapItems);
+
+    int fd = createTempFile(pq);
+    if (fd == -1)
+        return -1;
+
+    if (writeAll(fd, memory->array, memory->size * sizeof(HeapItem)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    if (mapRun(pq, fd, memory->size) != 0)
+        return -1;
+
+    pq->spilledItems += memory->size;
+    memory->size = 0;
+
+    return 0;
+}
+
+/*
+ * createExternalPQ - Creates an external-memory priority queue
+ * @memoryLimit: max items held in RAM before spilling a run
+ * @tempDir: directory for run files (NULL = $TMPDIR or /tmp)
+ *
+ * Returns: pointer to the queue, or NULL on failure
+ */
+ExternalPQ *createExternalPQ(int memoryLimit, const char *tempDir)
+{
+    if (memoryLimit < 1)
+        memoryLimit = 1;
+
+    ExternalPQ *pq = (ExternalPQ *)calloc(1, sizeof(ExternalPQ));
+    if (pq == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    if (tempDir == NULL)
+        tempDir = getenv("TMPDIR");
+    if (tempDir == NULL)
+        tempDir = "/tmp";
+    snprintf(pq->tempDir, sizeof(pq->tempDir), "%s", tempDir);
+
+    pq->memoryLimit = memoryLimit;
+    pq->memory = createHeap(memoryLimit);
+    pq->runHeads = createHeap(EXTPQ_MAX_RUNS);
+    pq->runs = (SpillRun *)calloc(EXTPQ_MAX_RUNS, sizeof(SpillRun));
+
+    if (pq->memory == NULL || pq->runHeads == NULL || pq->runs == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        freeExternalPQ(pq);
+        return NULL;
+    }
+
+    return pq;
+}
+
+void freeExternalPQ(ExternalPQ *pq)
+{
+    if (pq == NULL)
+        return;
+
+    if (pq->runs != NULL)
+    {
+        for (int i = 0; i < EXTPQ_MAX_RUNS; i++)
+        {
+            if (pq->runs[i].items != NULL)
+                closeRun(pq, &pq->runs[i]);
+        }
+        free(pq->runs);
+    }
+    freeHeap(pq->memory);
+    freeHeap(pq->runHeads);
+    free(pq);
+}
+
+/*
+ * externalPQPush - Inserts a (key, value) pair
+ *
+ * Returns: 0 on success, -1 if a spill failed (queue left unchanged: a
+ *          failed merge keeps its source runs, a failed run write keeps
+ *          the items in the memory heap)
+ *
+ * Time Complexity: O(log M) amortized, plus one sequential write of
+ * M items every M pushes (M = memoryLimit)
+ */
+int externalPQPush(ExternalPQ *pq, long long key, int value)
+{
+    if (pq->memory->size == pq->memoryLimit && spill(pq) != 0)
+        return -1;
+
+    heapPush(pq->memory, key, value);
+    pq->size++;
+
+    return 0;
+}
+
+/*
+ * externalPQTop - Copies the smallest item into *out without removing it
+ *
+ * Returns: 0 on success, -1 if the queue is empty
+ */
+int externalPQTop(ExternalPQ *pq, HeapItem *out)
+{
+    if (pq->size == 0)
+        return -1;
+
+    if (heapIsEmpty(pq->runHeads))
+    {
+        *out = heapTop(pq->memory);
+        return 0;
+    }
+
+    SpillRun *run = &pq->runs[heapTop(pq->runHeads).value];
+    HeapItem runTop = run->items[run->pos];
+
+    if (heapIsEmpty(pq->memory) || runTop.key < heapTop(pq->memory).key)
+        *out = runTop;
+    else
+        *out = heapTop(pq->memory);
+
+    return 0;
+}
+
+/*
+ * externalPQPop - Removes the smallest item and stores it in *out
+ *
+ * Returns: 0 on success, -1 if the queue is empty
+ *
+ * Time Complexity: O(log M + log R)
+ */
+int externalPQPop(ExternalPQ *pq, HeapItem *out)
+{
+    if (pq->size == 0)
+        return -1;
+
+    int fromRun = !heapIsEmpty(pq->runHeads) &&
+                  (heapIsEmpty(pq->memory) ||
+                   heapTop(pq->runHeads).key < heapTop(pq->memory).key);
+
+    if (fromRun)
+        popFromRuns(pq, out);
+    else
+        heapPop(pq->memory, out);
+
+    pq->size--;
+    return 0;
+}
+
+long long externalPQSize(ExternalPQ *pq)
+{
+    return pq->size;
+}
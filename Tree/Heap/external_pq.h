@@ -0,0 +1,65 @@
+#ifndef EXTERNAL_PQ_H
+#define EXTERNAL_PQ_H
+
+#include <stddef.h>
+#include "heap.h"
+
+/*
+ * ============================================================================
+ * EXTERNAL-MEMORY PRIORITY QUEUE
+ * ============================================================================
+ *
+ * A bounded in-memory Heap plus any number of sorted runs on disk.
+ *
+ *   push: goes into the memory heap. When the heap is full, its contents
+ *         are sorted and written to an (unlinked) temp file, which is then
+ *         mmap'd read-only as a new run.
+ *   pop:  smaller of (memory heap top, smallest run head). Run heads are
+ *         kept in a second small Heap keyed on each run's current item.
+ *
+ * Runs are only ever read front to back, so the mapping is advised
+ * MADV_SEQUENTIAL, the next window is prefetched with MADV_WILLNEED and
+ * consumed windows are dropped with MADV_DONTNEED. Once EXTPQ_MAX_RUNS runs
+ * exist, the EXTPQ_MERGE_RUNS shortest ones are merged into one, so file
+ * descriptors stay bounded while big runs from earlier merges are left
+ * alone (size-tiered: each item is rewritten O(log N) times, not once per
+ * merge).
+ * ============================================================================
+ */
+
+#define EXTPQ_MAX_RUNS 64
+#define EXTPQ_MERGE_RUNS (EXTPQ_MAX_RUNS / 2)
+#define EXTPQ_WINDOW_BYTES (4 << 20)
+
+typedef struct SpillRun
+{
+    int fd;
+    HeapItem *items;        // mmap'd, sorted ascending by key
+    long long length;
+    long long pos;          // next unread item
+    long long prefetched;   // items up to here already advised WILLNEED
+    size_t mappedBytes;
+} SpillRun;
+
+typedef struct ExternalPQ
+{
+    Heap *memory;           // bounded in-memory heap
+    int memoryLimit;
+    SpillRun *runs;
+    int runCount;
+    Heap *runHeads;         // key = run's current head key, value = run index
+    char tempDir[256];
+    long long size;
+    long long spilledItems; // total items ever written to disk by spills
+    long long mergedItems;  // total items rewritten by run merges
+} ExternalPQ;
+
+ExternalPQ *createExternalPQ(int memoryLimit, const char *tempDir);
+void freeExternalPQ(ExternalPQ *pq);
+
+int externalPQPush(ExternalPQ *pq, long long key, int value);
+int externalPQPop(ExternalPQ *pq, HeapItem *out);
+int externalPQTop(ExternalPQ *pq, HeapItem *out);
+long long externalPQSize(ExternalPQ *pq);
+
+#endif
@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "external_pq.h"
+
+/*
+ * Test driver / benchmark for external_pq.c
+ *
+ * Build: gcc -O2 heap.c external_pq.c external_pq_demo.c -o extpq
+ * Usage: ./extpq [items] [memoryLimit]
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+    long long items = (argc > 1) ? atoll(argv[1]) : 20000000LL;
+    int memoryLimit = (argc > 2) ? atoi(argv[2]) : (1 << 18);
+
+    ExternalPQ *pq = createExternalPQ(memoryLimit, NULL);
+    if (pq == NULL)
+        return 1;
+
+    srand(2024);
+    double start = nowSeconds();
+    for (long long i = 0; i < items; i++)
+    {
+        long long key = ((long long)rand() << 16) ^ rand();
+        if (externalPQPush(pq, key, (int)i) != 0)
+        {
+            printf("Push failed at item %lld\n", i);
+            freeExternalPQ(pq);
+            return 1;
+        }
+    }
+    double pushTime = nowSeconds() - start;
+
+    printf("Pushed %lld items with %d in memory: %lld spilled, %lld rewritten by merges "
+           "(%.1fx), %d live runs\n", items, memoryLimit, pq->spilledItems, pq->mergedItems,
+           pq->spilledItems ? (double)pq->mergedItems / pq->spilledItems : 0.0, pq->runCount);
+
+    // Interleave a few pushes with pops: new small keys must come out first
+    externalPQPush(pq, -5, -1);
+    externalPQPush(pq, -7, -2);
+
+    start = nowSeconds();
+    HeapItem previous, current;
+    long long popped = 0;
+    int ok = 1;
+    externalPQPop(pq, &previous);
+    popped++;
+    if (previous.key != -7)
+        ok = 0;
+    while (externalPQPop(pq, &current) == 0)
+    {
+        if (current.key < previous.key)
+            ok = 0;
+        previous = current;
+        popped++;
+    }
+    double popTime = nowSeconds() - start;
+
+    printf("Popped %lld items in order: %s\n", popped, (ok && popped == items + 2) ? "OK" : "FAILED");
+    printf("  push: %.2f s (%.1f M items/s)\n", pushTime, items / pushTime / 1e6);
+    printf("  pop : %.2f s (%.1f M items/s, %.0f MB/s of runs)\n",
+           popTime, popped / popTime / 1e6,
+           pq->spilledItems * sizeof(HeapItem) / popTime / 1e6);
+
+    freeExternalPQ(pq);
+    return (ok && popped == items + 2) ? 0 : 1;
+}
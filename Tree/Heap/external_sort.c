@@ -0,0 +1,459 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include "topk_merge.h"
+
+/*
+ * ============================================================================
+ * EXTERNAL MERGE SORT FOR BINARY INT FILES
+ * ============================================================================
+ *
+ * Input and output are raw arrays of native-endian 32-bit ints.
+ *
+ *   Phase 1 (parallel): the input is mmap'd; worker threads grab
+ *           memory-sized chunks, copy them out, radix sort them and write
+ *           each one as a run to an unlinked temp file, which is then
+ *           mmap'd and its fd closed.
+ *   Phase 2: all runs are merged with the LoserTree from topk_merge.c and
+ *           written through one large buffer, so every byte is read once
+ *           and written once, sequentially.
+ *
+ * The sorted output can be loaded straight into a height-balanced tree,
+ * see sortedArrayToBST in Tree/BST/BinarySearchTree.c.
+ *
+ * Build: gcc -O2 -pthread heap.c topk_merge.c external_sort.c -o extsort
+ * Usage: ./extsort gen  <file> <count>
+ *        ./extsort sort <input> <output> [memoryMB] [threads] [tempDir]
+ * ============================================================================
+ */
+
+#define OUTPUT_BUFFER_BYTES (8 << 20)
+
+typedef struct SortRun
+{
+    const int *items;   // mmap'd, ascending
+    long long length;
+} SortRun;
+
+typedef struct SortJob
+{
+    const int *input;
+    long long inputLength;
+    long long chunkItems;
+    long long chunkCount;
+    long long nextChunk;        // shared work counter
+    SortRun *runs;              // one per chunk
+    const char *tempDir;
+    int failed;
+} SortJob;
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int writeAll(int fd, const void *buffer, size_t bytes)
+{
+    const char *p = (const char *)buffer;
+
+    while (bytes > 0)
+    {
+        ssize_t written = write(fd, p, bytes);
+        if (written <= 0)
+        {
+            perror("write");
+            return -1;
+        }
+        p += written;
+        bytes -= written;
+    }
+
+    return 0;
+}
+
+/*
+ * radixSort - LSD radix sort of signed 32-bit ints, 4 passes of 8 bits
+ * @items: data to sort (result ends up here)
+ * @scratch: buffer of the same length
+ *
+ * The top byte is flipped so negative numbers sort before positive ones.
+ *
+ * Time Complexity: O(n), 4 sequential passes
+ */
+static void radixSort(int *items, int *scratch, long long n)
+{
+    unsigned int *src = (unsigned int *)items;
+    unsigned int *dst = (unsigned int *)scratch;
+
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        long long count[256] = {0};
+        unsigned int flip = (shift == 24) ? 0x80u : 0u;
+
+        for (long long i = 0; i < n; i++)
+            count[((src[i] >> shift) & 0xFF) ^ flip]++;
+
+        long long sum = 0;
+        for (int b = 0; b < 256; b++)
+        {
+            long long c = count[b];
+            count[b] = sum;
+            sum += c;
+        }
+
+        for (long long i = 0; i < n; i++)
+            dst[count[((src[i] >> shift) & 0xFF) ^ flip]++] = src[i];
+
+        unsigned int *temp = src;
+        src = dst;
+        dst = temp;
+    }
+    // 4 passes: result is back in items
+}
+
+/*
+ * writeRun - Writes a sorted chunk to an unlinked temp file and maps it
+ *
+ * Returns: 0 on success, -1 on failure
+ */
+static int writeRun(const char *tempDir, const int *items, long long length, SortRun *run)
+{
+    char path[300];
+    snprintf(path, sizeof(path), "%s/extsort-XXXXXX", tempDir);
+
+    int fd = mkstemp(path);
+    if (fd == -1)
+    {
+        perror("mkstemp");
+        return -1;
+    }
+    unlink(path);
+
+    size_t bytes = length * sizeof(int);
+    if (writeAll(fd, items, bytes) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    void *map = mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);      // the mapping keeps the file alive
+    if (map == MAP_FAILED)
+    {
+        perror("mmap");
+        return -1;
+    }
+    madvise(map, bytes, MADV_SEQUENTIAL);
+
+    run->items = (const int *)map;
+    run->length = length;
+    return 0;
+}
+
+/*
+ * sortWorker - Thread body: sort and spill chunks until none are left
+ */
+static void *sortWorker(void *arg)
+{
+    SortJob *job = (SortJob *)arg;
+
+    int *buffer = (int *)malloc(job->chunkItems * sizeof(int));
+    int *scratch = (int *)malloc(job->chunkItems * sizeof(int));
+    if (buffer == NULL || scratch == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+        free(buffer);
+        free(scratch);
+        return NULL;
+    }
+
+    for (;;)
+    {
+        long long chunk = __atomic_fetch_add(&job->nextChunk, 1, __ATOMIC_RELAXED);
+        if (chunk >= job->chunkCount)
+            break;
+
+        long long first = chunk * job->chunkItems;
+        long long length = job->inputLength - first;
+        if (length > job->chunkItems)
+            length = job->chunkItems;
+
+        memcpy(buffer, job->input + first, length * sizeof(int));
+        radixSort(buffer, scratch, length);
+
+        if (writeRun(job->tempDir, buffer, length, &job->runs[chunk]) != 0)
+        {
+            __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+            break;
+        }
+    }
+
+    free(buffer);
+    free(scratch);
+    return NULL;
+}
+
+/*
+ * mergeToFile - k-way merges every run into fd with a LoserTree
+ *
+ * Returns: number of ints written, or -1 on failure
+ */
+static long long mergeToFile(SortRun *runs, int runCount, int fd)
+{
+    long long *pos = (long long *)calloc(runCount, sizeof(long long));
+    int *keys = (int *)malloc(runCount * sizeof(int));
+    char *live = (char *)malloc(runCount);
+    int *buffer = (int *)malloc(OUTPUT_BUFFER_BYTES);
+    if (pos == NULL || keys == NULL || live == NULL || buffer == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(pos);
+        free(keys);
+        free(live);
+        free(buffer);
+        return -1;
+    }
+
+    for (int r = 0; r < runCount; r++)
+    {
+        live[r] = runs[r].length > 0;
+        keys[r] = live[r] ? runs[r].items[0] : 0;
+    }
+
+    LoserTree *lt = createLoserTree(runCount, keys, live);
+    long long written = (lt == NULL) ? -1 : 0;
+    long long buffered = 0;
+    long long bufferItems = OUTPUT_BUFFER_BYTES / sizeof(int);
+    int run;
+
+    while (lt != NULL && (run = loserTreeWinner(lt)) != -1)
+    {
+        buffer[buffered++] = loserTreeWinnerKey(lt);
+        if (buffered == bufferItems)
+        {
+            if (writeAll(fd, buffer, buffered * sizeof(int)) != 0)
+            {
+                written = -1;
+                break;
+            }
+            written += buffered;
+            buffered = 0;
+        }
+
+        if (++pos[run] < runs[run].length)
+            loserTreeReplace(lt, runs[run].items[pos[run]]);
+        else
+            loserTreeExhaust(lt);
+    }
+
+    if (written >= 0)
+    {
+        if (writeAll(fd, buffer, buffered * sizeof(int)) != 0)
+            written = -1;
+        else
+            written += buffered;
+    }
+
+    freeLoserTree(lt);
+    free(pos);
+    free(keys);
+    free(live);
+    free(buffer);
+    return written;
+}
+
+/*
+ * externalSort - Sorts a binary int file into another file
+ * @inputPath / @outputPath: raw int32 files
+ * @memoryBytes: total RAM budget for chunk buffers (all threads)
+ * @threads: number of sorting threads
+ * @tempDir: where runs are spilled
+ *
+ * Returns: 0 on success, -1 on failure
+ */
+static int externalSort(const char *inputPath, const char *outputPath,
+                        long long memoryBytes, int threads, const char *tempDir)
+{
+    int inFd = open(inputPath, O_RDONLY);
+    if (inFd == -1)
+    {
+        perror(inputPath);
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(inFd, &st) == -1)
+    {
+        perror(inputPath);
+        close(inFd);
+        return -1;
+    }
+    long long n = st.st_size / sizeof(int);
+
+    int outFd = open(outputPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (outFd == -1)
+    {
+        perror(outputPath);
+        close(inFd);
+        return -1;
+    }
+    if (n == 0)
+    {
+        close(inFd);
+        close(outFd);
+        return 0;
+    }
+
+    const int *input = (const int *)mmap(NULL, n * sizeof(int), PROT_READ, MAP_PRIVATE, inFd, 0);
+    close(inFd);
+    if (input == MAP_FAILED)
+    {
+        perror("mmap");
+        close(outFd);
+        return -1;
+    }
+    madvise((void *)input, n * sizeof(int), MADV_SEQUENTIAL);
+
+    // Each thread holds a chunk buffer and an equally sized radix scratch
+    SortJob job;
+    job.input = input;
+    job.inputLength = n;
+    job.chunkItems = memoryBytes / (2 * (long long)sizeof(int) * threads);
+    if (job.chunkItems < 1024)
+        job.chunkItems = 1024;
+    job.chunkCount = (n + job.chunkItems - 1) / job.chunkItems;
+    job.nextChunk = 0;
+    job.tempDir = tempDir;
+    job.failed = 0;
+    job.runs = (SortRun *)calloc(job.chunkCount, sizeof(SortRun));
+
+    double start = nowSeconds();
+    pthread_t *workers = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    if (job.runs == NULL || workers == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(job.runs);
+        free(workers);
+        munmap((void *)input, n * sizeof(int));
+        close(outFd);
+        return -1;
+    }
+
+    // Threads that did start still take every chunk, so join them first
+    int started = 0;
+    for (; started < threads; started++)
+    {
+        int error = pthread_create(&workers[started], NULL, sortWorker, &job);
+        if (error != 0)
+        {
+            printf("pthread_create: %s\n", strerror(error));
+            __atomic_store_n(&job.failed, 1, __ATOMIC_RELAXED);
+            break;
+        }
+    }
+    for (int t = 0; t < started; t++)
+        pthread_join(workers[t], NULL);
+    free(workers);
+    munmap((void *)input, n * sizeof(int));
+    double runTime = nowSeconds() - start;
+
+    long long written = -1;
+    double mergeTime = 0;
+    if (!job.failed)
+    {
+        start = nowSeconds();
+        written = mergeToFile(job.runs, (int)job.chunkCount, outFd);
+        mergeTime = nowSeconds() - start;
+    }
+
+    for (long long r = 0; r < job.chunkCount; r++)
+    {
+        if (job.runs[r].items != NULL)
+            munmap((void *)job.runs[r].items, job.runs[r].length * sizeof(int));
+    }
+    free(job.runs);
+    close(outFd);
+
+    if (written != n)
+    {
+        printf("External sort failed!\n");
+        return -1;
+    }
+
+    double mb = n * sizeof(int) / 1e6;
+    printf("Sorted %lld ints (%.0f MB) using %lld runs of %lld ints, %d threads\n",
+           n, mb, job.chunkCount, job.chunkItems, threads);
+    printf("  run formation: %.2f s (%.0f MB/s)\n", runTime, mb / runTime);
+    printf("  merge        : %.2f s (%.0f MB/s)\n", mergeTime, mb / mergeTime);
+    return 0;
+}
+
+/*
+ * generateFile - Writes count random ints, for benchmarking
+ */
+static int generateFile(const char *path, long long count)
+{
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1)
+    {
+        perror(path);
+        return -1;
+    }
+
+    int *buffer = (int *)malloc(OUTPUT_BUFFER_BYTES);
+    long long bufferItems = OUTPUT_BUFFER_BYTES / sizeof(int);
+    unsigned int state = 12345;
+    int status = 0;
+
+    for (long long done = 0; done < count && status == 0;)
+    {
+        long long batch = count - done;
+        if (batch > bufferItems)
+            batch = bufferItems;
+
+        for (long long i = 0; i < batch; i++)
+        {
+            // xorshift32
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            buffer[i] = (int)state;
+        }
+        status = writeAll(fd, buffer, batch * sizeof(int));
+        done += batch;
+    }
+
+    free(buffer);
+    close(fd);
+    return status;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc == 4 && strcmp(argv[1], "gen") == 0)
+        return generateFile(argv[2], atoll(argv[3])) == 0 ? 0 : 1;
+
+    if (argc >= 4 && strcmp(argv[1], "sort") == 0)
+    {
+        long long memoryMB = (argc > 4) ? atoll(argv[4]) : 256;
+        int threads = (argc > 5) ? atoi(argv[5]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+        const char *tempDir = (argc > 6) ? argv[6] : "/tmp";
+        if (threads < 1)
+            threads = 1;
+
+        return externalSort(argv[2], argv[3], memoryMB << 20, threads, tempDir) == 0 ? 0 : 1;
+    }
+
+    printf("Usage: %s gen  <file> <count>\n", argv[0]);
+    printf("       %s sort <input> <output> [memoryMB] [threads] [tempDir]\n", argv[0]);
+    return 1;
+}
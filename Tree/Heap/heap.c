@@ -0,0 +1,181 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "heap.h"
+
+/*
+ * createHeap - Allocates an empty heap
+ * @capacity: initial number of slots (grows on demand in heapPush)
+ *
+ * Returns: pointer to the heap, or NULL if allocation failed
+ */
+Heap *createHeap(int capacity)
+{
+    if (capacity < 1)
+        capacity = 1;
+
+    Heap *heap = (Heap *)malloc(sizeof(Heap));
+    if (heap == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    heap->array = (HeapItem *)malloc(capacity * sizeof(HeapItem));
+    if (heap->array == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(heap);
+        return NULL;
+    }
+    heap->size = 0;
+    heap->capacity = capacity;
+
+    return heap;
+}
+
+void freeHeap(Heap *heap)
+{
+    if (heap == NULL)
+        return;
+    free(heap->array);
+    free(heap);
+}
+
+int heapIsEmpty(Heap *heap)
+{
+    return heap->size == 0;
+}
+
+/*
+ * siftUp - Moves the item at index up until its parent is not larger
+ *
+ * Same "hole" technique as heaptree.c: keep the moving item in a temp,
+ * shift parents down, write the item once at the end.
+ */
+static void siftUp(Heap *heap, int index)
+{
+    HeapItem temp = heap->array[index];
+
+    while (index > 0 && temp.key < heap->array[(index - 1) / 2].key)
+    {
+        heap->array[index] = heap->array[(index - 1) / 2];
+        index = (index - 1) / 2;
+    }
+    heap->array[index] = temp;
+}
+
+/*
+ * siftDown - Moves the item at index down until both children are not smaller
+ */
+static void siftDown(Heap *heap, int index)
+{
+    HeapItem temp = heap->array[index];
+    int size = heap->size;
+
+    while (2 * index + 1 < size)
+    {
+        int child = 2 * index + 1;
+
+        // Pick the smaller child
+        if (child + 1 < size && heap->array[child + 1].key < heap->array[child].key)
+            child++;
+
+        if (heap->array[child].key >= temp.key)
+            break;
+
+        heap->array[index] = heap->array[child];
+        index = child;
+    }
+    heap->array[index] = temp;
+}
+
+/*
+ * heapPush - Inserts a (key, value) pair
+ *
+ * Returns: 0 on success, -1 if the array could not grow
+ *
+ * Time Complexity: O(log n), amortized O(1) growth
+ */
+int heapPush(Heap *heap, long long key, int value)
+{
+    if (heap->size == heap->capacity)
+    {
+        int newCapacity = heap->capacity * 2;
+        HeapItem *grown = (HeapItem *)realloc(heap->array, newCapacity * sizeof(HeapItem));
+        if (grown == NULL)
+        {
+            printf("Memory allocation failed!\n");
+            return -1;
+        }
+        heap->array = grown;
+        heap->capacity = newCapacity;
+    }
+
+    heap->array[heap->size].key = key;
+    heap->array[heap->size].value = value;
+    heap->size++;
+    siftUp(heap, heap->size - 1);
+
+    return 0;
+}
+
+/*
+ * heapPop - Removes the smallest item and stores it in *out
+ *
+ * Returns: 0 on success, -1 if the heap is empty
+ *
+ * Time Complexity: O(log n)
+ */
+int heapPop(Heap *heap, HeapItem *out)
+{
+    if (heap->size == 0)
+        return -1;
+
+    *out = heap->array[0];
+    heap->size--;
+    if (heap->size > 0)
+    {
+        heap->array[0] = heap->array[heap->size];
+        siftDown(heap, 0);
+    }
+
+    return 0;
+}
+
+/*
+ * heapTop - Returns the smallest item without removing it
+ * Caller must check heapIsEmpty first.
+ */
+HeapItem heapTop(Heap *heap)
+{
+    return heap->array[0];
+}
+
+/*
+ * heapReplaceTop - Overwrites the root and restores the heap property
+ *
+ * Equivalent to heapPop + heapPush but with a single sift-down,
+ * which is what bounded top-K and run merging need.
+ *
+ * Time Complexity: O(log n)
+ */
+void heapReplaceTop(Heap *heap, long long key, int value)
+{
+    heap->array[0].key = key;
+    heap->array[0].value = value;
+    siftDown(heap, 0);
+}
+
+/*
+ * heapBuild - Turns heap->array[0 .. size-1] into a heap in place
+ *
+ * Floyd's bottom-up construction: sift down every internal node,
+ * last one first.
+ *
+ * Time Complexity: O(n)
+ */
+void heapBuild(Heap *heap)
+{
+    for (int i = heap->size / 2 - 1; i >= 0; i--)
+        siftDown(heap, i);
+}
@@ -0,0 +1,42 @@
+#ifndef HEAP_H
+#define HEAP_H
+
+/*
+ * ============================================================================
+ * BINARY MIN-HEAP (array based)
+ * ============================================================================
+ *
+ * Working version of the sift-up idea sketched in heaptree.c, 0-indexed:
+ *   parent(i) = (i - 1) / 2
+ *   left(i)   = 2 * i + 1
+ *   right(i)  = 2 * i + 2
+ *
+ * Each slot holds a (key, value) pair and the smallest key sits at index 0.
+ * The value is a payload the heap never looks at (run id, vertex id, ...).
+ * ============================================================================
+ */
+
+typedef struct HeapItem
+{
+    long long key;
+    int value;
+} HeapItem;
+
+typedef struct Heap
+{
+    HeapItem *array;
+    int size;
+    int capacity;
+} Heap;
+
+Heap *createHeap(int capacity);
+void freeHeap(Heap *heap);
+
+int heapIsEmpty(Heap *heap);
+int heapPush(Heap *heap, long long key, int value);
+int heapPop(Heap *heap, HeapItem *out);
+HeapItem heapTop(Heap *heap);
+void heapReplaceTop(Heap *heap, long long key, int value);
+void heapBuild(Heap *heap);
+
+#endif
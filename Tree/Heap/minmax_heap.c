@@ -0,0 +1,280 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "minmax_heap.h"
+
+/*
+ * createMinMaxHeap - Allocates an empty min-max heap
+ * @capacity: initial number of slots (grows on demand)
+ *
+ * Returns: pointer to the heap, or NULL if allocation failed
+ */
+MinMaxHeap *createMinMaxHeap(int capacity)
+{
+    if (capacity < 1)
+        capacity = 1;
+
+    MinMaxHeap *heap = (MinMaxHeap *)malloc(sizeof(MinMaxHeap));
+    if (heap == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    heap->array = (HeapItem *)malloc(capacity * sizeof(HeapItem));
+    if (heap->array == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(heap);
+        return NULL;
+    }
+    heap->size = 0;
+    heap->capacity = capacity;
+
+    return heap;
+}
+
+void freeMinMaxHeap(MinMaxHeap *heap)
+{
+    if (heap == NULL)
+        return;
+    free(heap->array);
+    free(heap);
+}
+
+int minMaxHeapIsEmpty(MinMaxHeap *heap)
+{
+    return heap->size == 0;
+}
+
+/*
+ * isMinLevel - Returns 1 if index sits on an even (min) level
+ */
+static int isMinLevel(int index)
+{
+    int level = 0;
+
+    for (unsigned int n = (unsigned int)index + 1; n > 1; n >>= 1)
+        level++;
+
+    return (level % 2) == 0;
+}
+
+static void swapItems(HeapItem *array, int a, int b)
+{
+    HeapItem temp = array[a];
+    array[a] = array[b];
+    array[b] = temp;
+}
+
+/*
+ * better - Ordering used on a level: "smaller" on min levels,
+ * "larger" on max levels
+ */
+static int better(long long a, long long b, int minLevel)
+{
+    return minLevel ? (a < b) : (a > b);
+}
+
+/*
+ * bubbleUpSameKind - Moves an item up through grandparents, i.e. through
+ * levels of the same kind (min-min-min or max-max-max)
+ */
+static void bubbleUpSameKind(HeapItem *array, int index, int minLevel)
+{
+    while (index > 2)
+    {
+        int grandparent = ((index - 1) / 2 - 1) / 2;
+        if (!better(array[index].key, array[grandparent].key, minLevel))
+            break;
+
+        swapItems(array, index, grandparent);
+        index = grandparent;
+    }
+}
+
+/*
+ * bubbleUp - Restores the heap after placing a new item at index
+ *
+ * If the item violates the order with its parent (which is on the
+ * opposite kind of level) it swaps once and continues on the parent's
+ * kind of level; otherwise it continues on its own kind of level.
+ */
+static void bubbleUp(HeapItem *array, int index)
+{
+    if (index == 0)
+        return;
+
+    int parent = (index - 1) / 2;
+    int minLevel = isMinLevel(index);
+
+    if (better(array[index].key, array[parent].key, !minLevel))
+    {
+        swapItems(array, index, parent);
+        bubbleUpSameKind(array, parent, !minLevel);
+    }
+    else
+    {
+        bubbleUpSameKind(array, index, minLevel);
+    }
+}
+
+/*
+ * trickleDown - Restores the heap below index after its item changed
+ *
+ * Looks at up to 2 children and 4 grandchildren and picks the best one
+ * for this level. If it is a grandchild, the item moves two levels down
+ * and may need one swap with the grandchild's parent (opposite kind).
+ *
+ * Time Complexity: O(log n)
+ */
+static void trickleDown(MinMaxHeap *heap, int index)
+{
+    HeapItem *array = heap->array;
+    int size = heap->size;
+    int minLevel = isMinLevel(index);
+
+    while (2 * index + 1 < size)
+    {
+        // Best among children and grandchildren
+        int best = 2 * index + 1;
+        int candidates[] = {2 * index + 2,
+                            4 * index + 3, 4 * index + 4, 4 * index + 5, 4 * index + 6};
+        for (int c = 0; c < 5 && candidates[c] < size; c++)
+        {
+            if (better(array[candidates[c]].key, array[best].key, minLevel))
+                best = candidates[c];
+        }
+
+        if (!better(array[best].key, array[index].key, minLevel))
+            return;
+
+        swapItems(array, best, index);
+
+        // A child: one level only, we are done
+        if (best <= 2 * index + 2)
+            return;
+
+        // A grandchild: fix order with its parent, keep going from there
+        int parent = (best - 1) / 2;
+        if (better(array[best].key, array[parent].key, !minLevel))
+            swapItems(array, best, parent);
+
+        index = best;
+    }
+}
+
+/*
+ * minMaxHeapPush - Inserts a (key, value) pair
+ *
+ * Returns: 0 on success, -1 if the array could not grow
+ *
+ * Time Complexity: O(log n)
+ */
+int minMaxHeapPush(MinMaxHeap *heap, long long key, int value)
+{
+    if (heap->size == heap->capacity)
+    {
+        int newCapacity = heap->capacity * 2;
+        HeapItem *grown = (HeapItem *)realloc(heap->array, newCapacity * sizeof(HeapItem));
+        if (grown == NULL)
+        {
+            printf("Memory allocation failed!\n");
+            return -1;
+        }
+        heap->array = grown;
+        heap->capacity = newCapacity;
+    }
+
+    heap->array[heap->size].key = key;
+    heap->array[heap->size].value = value;
+    heap->size++;
+    bubbleUp(heap->array, heap->size - 1);
+
+    return 0;
+}
+
+/*
+ * maxIndex - Index of the largest item: the root if alone,
+ * otherwise the larger of the root's children
+ */
+static int maxIndex(MinMaxHeap *heap)
+{
+    if (heap->size == 1)
+        return 0;
+    if (heap->size == 2 || heap->array[1].key >= heap->array[2].key)
+        return 1;
+    return 2;
+}
+
+/*
+ * minMaxHeapMin / minMaxHeapMax - O(1) peeks, caller checks for empty
+ */
+HeapItem minMaxHeapMin(MinMaxHeap *heap)
+{
+    return heap->array[0];
+}
+
+HeapItem minMaxHeapMax(MinMaxHeap *heap)
+{
+    return heap->array[maxIndex(heap)];
+}
+
+/*
+ * removeAt - Replaces slot index with the last item and trickles it down
+ */
+static void removeAt(MinMaxHeap *heap, int index, HeapItem *out)
+{
+    *out = heap->array[index];
+    heap->size--;
+
+    if (index < heap->size)
+    {
+        heap->array[index] = heap->array[heap->size];
+        trickleDown(heap, index);
+    }
+}
+
+/*
+ * minMaxHeapPopMin - Removes the smallest item
+ *
+ * Returns: 0 on success, -1 if empty
+ *
+ * Time Complexity: O(log n)
+ */
+int minMaxHeapPopMin(MinMaxHeap *heap, HeapItem *out)
+{
+    if (heap->size == 0)
+        return -1;
+
+    removeAt(heap, 0, out);
+    return 0;
+}
+
+/*
+ * minMaxHeapPopMax - Removes the largest item
+ *
+ * Returns: 0 on success, -1 if empty
+ *
+ * Time Complexity: O(log n)
+ */
+int minMaxHeapPopMax(MinMaxHeap *heap, HeapItem *out)
+{
+    if (heap->size == 0)
+        return -1;
+
+    removeAt(heap, maxIndex(heap), out);
+    return 0;
+}
+
+/*
+ * minMaxHeapBuild - Turns heap->array[0 .. size-1] into a min-max heap
+ *
+ * Floyd-style: trickle down every internal node, last one first.
+ *
+ * Time Complexity: O(n)
+ */
+void minMaxHeapBuild(MinMaxHeap *heap)
+{
+    for (int i = heap->size / 2 - 1; i >= 0; i--)
+        trickleDown(heap, i);
+}
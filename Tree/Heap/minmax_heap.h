@@ -0,0 +1,42 @@
+#ifndef MINMAX_HEAP_H
+#define MINMAX_HEAP_H
+
+#include "heap.h"
+
+/*
+ * ============================================================================
+ * MIN-MAX HEAP (double-ended priority queue)
+ * ============================================================================
+ *
+ * One array, same index math as heap.c, but levels alternate:
+ *
+ *   level 0 (min):            [ 5 ]
+ *   level 1 (max):       [ 70 ]    [ 60 ]
+ *   level 2 (min):    [10] [12]    [ 8] [9]
+ *   level 3 (max):  [40][50] ...
+ *
+ * Every node on a min level is <= all of its descendants, every node on a
+ * max level is >= all of its descendants. So the minimum is the root and
+ * the maximum is one of the root's two children.
+ * ============================================================================
+ */
+
+typedef struct MinMaxHeap
+{
+    HeapItem *array;
+    int size;
+    int capacity;
+} MinMaxHeap;
+
+MinMaxHeap *createMinMaxHeap(int capacity);
+void freeMinMaxHeap(MinMaxHeap *heap);
+
+int minMaxHeapIsEmpty(MinMaxHeap *heap);
+int minMaxHeapPush(MinMaxHeap *heap, long long key, int value);
+HeapItem minMaxHeapMin(MinMaxHeap *heap);
+HeapItem minMaxHeapMax(MinMaxHeap *heap);
+int minMaxHeapPopMin(MinMaxHeap *heap, HeapItem *out);
+int minMaxHeapPopMax(MinMaxHeap *heap, HeapItem *out);
+void minMaxHeapBuild(MinMaxHeap *heap);
+
+#endif
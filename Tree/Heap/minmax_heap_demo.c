@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "minmax_heap.h"
+
+/*
+ * Test driver / benchmark for minmax_heap.c
+ *
+ * Baseline is the "two heaps kept in sync" approach: a min-heap and a
+ * mirrored max-heap (negated keys) over the same items, with a removed[]
+ * flag so an item popped from one side is skipped lazily on the other.
+ *
+ * Build: gcc -O2 heap.c minmax_heap.c minmax_heap_demo.c -o minmax && ./minmax
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+typedef struct MirroredHeaps
+{
+    Heap *minSide;
+    Heap *maxSide;          // keys stored negated
+    char *removed;          // indexed by item value
+} MirroredHeaps;
+
+static int mirroredPopMin(MirroredHeaps *m, HeapItem *out)
+{
+    while (heapPop(m->minSide, out) == 0)
+    {
+        if (!m->removed[out->value])
+        {
+            m->removed[out->value] = 1;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static int mirroredPopMax(MirroredHeaps *m, HeapItem *out)
+{
+    while (heapPop(m->maxSide, out) == 0)
+    {
+        if (!m->removed[out->value])
+        {
+            m->removed[out->value] = 1;
+            out->key = -out->key;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+int main(int argc, char **argv)
+{
+    // ---- Small correctness demo ----
+    MinMaxHeap *heap = createMinMaxHeap(4);
+    int values[] = {40, 5, 70, 12, 60, 8, 10, 50, 9};
+    for (int i = 0; i < 9; i++)
+        minMaxHeapPush(heap, values[i], i);
+
+    printf("min = %lld, max = %lld\n", minMaxHeapMin(heap).key, minMaxHeapMax(heap).key);
+    printf("Alternating popMin/popMax: ");
+    HeapItem item;
+    for (int turn = 0; !minMaxHeapIsEmpty(heap); turn++)
+    {
+        if (turn % 2 == 0)
+            minMaxHeapPopMin(heap, &item);
+        else
+            minMaxHeapPopMax(heap, &item);
+        printf("%lld ", item.key);
+    }
+    printf("\n");               // Expected: 5 70 8 60 9 50 10 40 12
+    freeMinMaxHeap(heap);
+
+    // ---- Randomized check + benchmark ----
+    int n = (argc > 1) ? atoi(argv[1]) : 2000000;
+    long long *keys = (long long *)malloc(n * sizeof(long long));
+    srand(7);
+    for (int i = 0; i < n; i++)
+        keys[i] = rand();
+
+    // Min-max heap: O(n) build, then alternate popMin / popMax
+    double start = nowSeconds();
+    heap = createMinMaxHeap(n);
+    for (int i = 0; i < n; i++)
+    {
+        heap->array[i].key = keys[i];
+        heap->array[i].value = i;
+    }
+    heap->size = n;
+    minMaxHeapBuild(heap);
+    double buildTime = nowSeconds() - start;
+
+    long long *mmOrder = (long long *)malloc(n * sizeof(long long));
+    start = nowSeconds();
+    for (int i = 0; i < n; i++)
+    {
+        if (i % 2 == 0)
+            minMaxHeapPopMin(heap, &item);
+        else
+            minMaxHeapPopMax(heap, &item);
+        mmOrder[i] = item.key;
+    }
+    double popTime = nowSeconds() - start;
+    freeMinMaxHeap(heap);
+
+    // Mirrored binary heaps doing the same work
+    start = nowSeconds();
+    MirroredHeaps mirrored;
+    mirrored.minSide = createHeap(n);
+    mirrored.maxSide = createHeap(n);
+    mirrored.removed = (char *)calloc(n, 1);
+    for (int i = 0; i < n; i++)
+    {
+        mirrored.minSide->array[i].key = keys[i];
+        mirrored.minSide->array[i].value = i;
+        mirrored.maxSide->array[i].key = -keys[i];
+        mirrored.maxSide->array[i].value = i;
+    }
+    mirrored.minSide->size = n;
+    mirrored.maxSide->size = n;
+    heapBuild(mirrored.minSide);
+    heapBuild(mirrored.maxSide);
+    double mirroredBuildTime = nowSeconds() - start;
+
+    int ok = 1;
+    start = nowSeconds();
+    for (int i = 0; i < n; i++)
+    {
+        if (i % 2 == 0)
+            mirroredPopMin(&mirrored, &item);
+        else
+            mirroredPopMax(&mirrored, &item);
+        if (item.key != mmOrder[i])
+            ok = 0;
+    }
+    double mirroredPopTime = nowSeconds() - start;
+
+    printf("\n%d items, alternating popMin/popMax: %s\n", n, ok ? "OK (matches mirrored heaps)" : "MISMATCH");
+    printf("  min-max heap   : build %.3f s, pops %.3f s, %zu bytes/item\n",
+           buildTime, popTime, sizeof(HeapItem));
+    printf("  mirrored heaps : build %.3f s, pops %.3f s, %zu bytes/item\n",
+           mirroredBuildTime, mirroredPopTime, 2 * sizeof(HeapItem) + 1);
+
+    freeHeap(mirrored.minSide);
+    freeHeap(mirrored.maxSide);
+    free(mirrored.removed);
+    free(keys);
+    free(mmOrder);
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,355 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "topk_merge.h"
+
+/*
+ * createTopK - Creates a bounded top-K collector
+ * @k: number of largest keys to keep
+ *
+ * Returns: pointer to the collector, or NULL on failure
+ */
+TopK *createTopK(int k)
+{
+    TopK *topk = (TopK *)malloc(sizeof(TopK));
+    if (topk == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    topk->heap = createHeap(k);
+    if (topk->heap == NULL)
+    {
+        free(topk);
+        return NULL;
+    }
+    topk->k = k;
+
+    return topk;
+}
+
+void freeTopK(TopK *topk)
+{
+    if (topk == NULL)
+        return;
+    freeHeap(topk->heap);
+    free(topk);
+}
+
+/*
+ * topKPush - Offers one stream element to the collector
+ * @key: ranking key (larger is better)
+ * @value: payload kept alongside the key
+ *
+ * Time Complexity: O(1) if rejected, O(log K) if it enters the top-K
+ */
+void topKPush(TopK *topk, long long key, int value)
+{
+    if (topk->k <= 0)
+        return;
+
+    // Still filling up: every element is a candidate
+    if (topk->heap->size < topk->k)
+    {
+        heapPush(topk->heap, key, value);
+        return;
+    }
+
+    // Root is the smallest of the current top-K; only bigger keys get in
+    if (key > heapTop(topk->heap).key)
+        heapReplaceTop(topk->heap, key, value);
+}
+
+/*
+ * topKDrain - Empties the collector into out[], largest key first
+ *
+ * Returns: number of items written (min(K, elements seen))
+ *
+ * Time Complexity: O(K log K)
+ */
+int topKDrain(TopK *topk, HeapItem *out)
+{
+    int count = topk->heap->size;
+
+    // Min-heap pops in ascending order, so fill out[] from the back
+    for (int i = count - 1; i >= 0; i--)
+        heapPop(topk->heap, &out[i]);
+
+    return count;
+}
+
+/*
+ * beats - Returns 1 if run a should be output before run b
+ *
+ * Exhausted runs lose against everything; ties go to the lower run
+ * index so the merge is stable across runs.
+ */
+static int beats(LoserTree *lt, int a, int b)
+{
+    if (!lt->live[b])
+        return 1;
+    if (!lt->live[a])
+        return 0;
+
+    lt->comparisons++;
+    if (lt->keys[a] != lt->keys[b])
+        return lt->keys[a] < lt->keys[b];
+    return a < b;
+}
+
+/*
+ * createLoserTree - Builds a tournament over k runs
+ * @k: number of runs
+ * @keys: head key of every run (ignored where live[i] == 0)
+ * @live: 1 if run i has a head element, 0 if it is already empty
+ *
+ * Leaves are implicit at positions k .. 2k-1, internal nodes at 1 .. k-1.
+ *
+ * Time Complexity: O(k)
+ */
+LoserTree *createLoserTree(int k, const int *keys, const char *live)
+{
+    LoserTree *lt = (LoserTree *)malloc(sizeof(LoserTree));
+    if (lt == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return NULL;
+    }
+
+    lt->k = k;
+    lt->comparisons = 0;
+    lt->tree = (int *)malloc(k * sizeof(int));
+    lt->keys = (int *)malloc(k * sizeof(int));
+    lt->live = (char *)malloc(k);
+    int *winner = (int *)malloc(2 * k * sizeof(int));
+
+    if (lt->tree == NULL || lt->keys == NULL || lt->live == NULL || winner == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(winner);
+        freeLoserTree(lt);
+        return NULL;
+    }
+
+    for (int i = 0; i < k; i++)
+    {
+        lt->keys[i] = keys[i];
+        lt->live[i] = live[i];
+        winner[k + i] = i;
+    }
+
+    // Play the initial tournament bottom-up
+    for (int node = k - 1; node >= 1; node--)
+    {
+        int a = winner[2 * node];
+        int b = winner[2 * node + 1];
+
+        if (beats(lt, a, b))
+        {
+            winner[node] = a;
+            lt->tree[node] = b;
+        }
+        else
+        {
+            winner[node] = b;
+            lt->tree[node] = a;
+        }
+    }
+    lt->tree[0] = (k > 1) ? winner[1] : 0;
+
+    free(winner);
+    return lt;
+}
+
+void freeLoserTree(LoserTree *lt)
+{
+    if (lt == NULL)
+        return;
+    free(lt->tree);
+    free(lt->keys);
+    free(lt->live);
+    free(lt);
+}
+
+/*
+ * loserTreeWinner - Returns the run holding the smallest head, or -1 when
+ * every run is exhausted
+ */
+int loserTreeWinner(LoserTree *lt)
+{
+    int w = lt->tree[0];
+    return lt->live[w] ? w : -1;
+}
+
+int loserTreeWinnerKey(LoserTree *lt)
+{
+    return lt->keys[lt->tree[0]];
+}
+
+/*
+ * replay - Re-runs the matches on the path from the winner's leaf to the root
+ *
+ * Time Complexity: O(log k), exactly one comparison per level
+ */
+static void replay(LoserTree *lt)
+{
+    int winner = lt->tree[0];
+    int node = (lt->k + winner) / 2;
+
+    while (node > 0)
+    {
+        // The stored loser wins this time: swap roles
+        if (beats(lt, lt->tree[node], winner))
+        {
+            int temp = lt->tree[node];
+            lt->tree[node] = winner;
+            winner = temp;
+        }
+        node /= 2;
+    }
+    lt->tree[0] = winner;
+}
+
+/*
+ * loserTreeReplace - The winner run advanced; key is its new head
+ */
+void loserTreeReplace(LoserTree *lt, int key)
+{
+    lt->keys[lt->tree[0]] = key;
+    replay(lt);
+}
+
+/*
+ * loserTreeExhaust - The winner run has no more elements
+ */
+void loserTreeExhaust(LoserTree *lt)
+{
+    lt->live[lt->tree[0]] = 0;
+    replay(lt);
+}
+
+/*
+ * mergeSortedArrays - Merges k ascending arrays into out[]
+ * @arrays: k pointers to sorted arrays
+ * @lengths: length of every array
+ * @k: number of arrays
+ * @out: destination, must hold sum(lengths) ints
+ *
+ * Returns: number of elements written, or -1 on allocation failure
+ *
+ * Time Complexity: O(N log k) for N total elements
+ */
+long long mergeSortedArrays(const int **arrays, const int *lengths, int k, int *out)
+{
+    if (k <= 0)
+        return 0;
+
+    int *pos = (int *)calloc(k, sizeof(int));
+    int *keys = (int *)malloc(k * sizeof(int));
+    char *live = (char *)malloc(k);
+    if (pos == NULL || keys == NULL || live == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(pos);
+        free(keys);
+        free(live);
+        return -1;
+    }
+
+    for (int i = 0; i < k; i++)
+    {
+        live[i] = lengths[i] > 0;
+        keys[i] = live[i] ? arrays[i][0] : 0;
+    }
+
+    LoserTree *lt = createLoserTree(k, keys, live);
+    free(keys);
+    free(live);
+    if (lt == NULL)
+    {
+        free(pos);
+        return -1;
+    }
+
+    long long count = 0;
+    int run;
+    while ((run = loserTreeWinner(lt)) != -1)
+    {
+        out[count++] = loserTreeWinnerKey(lt);
+
+        pos[run]++;
+        if (pos[run] < lengths[run])
+            loserTreeReplace(lt, arrays[run][pos[run]]);
+        else
+            loserTreeExhaust(lt);
+    }
+
+    freeLoserTree(lt);
+    free(pos);
+    return count;
+}
+
+/*
+ * mergeSortedLists - Merges k ascending singly linked lists into one
+ * @lists: k list heads (e.g. lists built with insertSorted); each entry
+ *         is consumed and set to NULL
+ * @k: number of lists
+ *
+ * Returns: head of the merged list
+ *
+ * Nodes are relinked, not copied: no node is allocated or freed.
+ *
+ * Time Complexity: O(N log k)
+ */
+struct Node *mergeSortedLists(struct Node **lists, int k)
+{
+    if (k <= 0)
+        return NULL;
+
+    int *keys = (int *)malloc(k * sizeof(int));
+    char *live = (char *)malloc(k);
+    if (keys == NULL || live == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(keys);
+        free(live);
+        return NULL;
+    }
+
+    for (int i = 0; i < k; i++)
+    {
+        live[i] = lists[i] != NULL;
+        keys[i] = live[i] ? lists[i]->data : 0;
+    }
+
+    LoserTree *lt = createLoserTree(k, keys, live);
+    free(keys);
+    free(live);
+    if (lt == NULL)
+        return NULL;
+
+    struct Node *head = NULL;
+    struct Node *tail = NULL;
+    int run;
+    while ((run = loserTreeWinner(lt)) != -1)
+    {
+        // Unlink the winning node from its run and append it to the output
+        struct Node *node = lists[run];
+        lists[run] = node->Next;
+
+        node->Next = NULL;
+        if (tail == NULL)
+            head = node;
+        else
+            tail->Next = node;
+        tail = node;
+
+        if (lists[run] != NULL)
+            loserTreeReplace(lt, lists[run]->data);
+        else
+            loserTreeExhaust(lt);
+    }
+
+    freeLoserTree(lt);
+    return head;
+}
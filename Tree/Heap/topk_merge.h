@@ -0,0 +1,54 @@
+#ifndef TOPK_MERGE_H
+#define TOPK_MERGE_H
+
+#include "heap.h"
+#include "../../Linked-List/singly_linked_list.h"
+
+/*
+ * ============================================================================
+ * STREAMING TOP-K AND K-WAY MERGE
+ * ============================================================================
+ *
+ * TopK       - keeps the K largest keys seen so far in a size-K min-heap.
+ *              A new key only enters if it beats the current K-th largest,
+ *              and then it costs a single heapReplaceTop.
+ *
+ * LoserTree  - tournament tree over K sorted runs. Each internal node keeps
+ *              the run that LOST the match there; tree[0] holds the overall
+ *              winner. Advancing the winner replays one leaf-to-root path,
+ *              so every output element costs ceil(log2 K) comparisons
+ *              (a binary heap needs up to 2 per level).
+ * ============================================================================
+ */
+
+typedef struct TopK
+{
+    Heap *heap;
+    int k;
+} TopK;
+
+TopK *createTopK(int k);
+void freeTopK(TopK *topk);
+void topKPush(TopK *topk, long long key, int value);
+int topKDrain(TopK *topk, HeapItem *out);
+
+typedef struct LoserTree
+{
+    int k;
+    int *tree;              // tree[0] = winner run, tree[1..k-1] = losers
+    int *keys;              // current head key of every run
+    char *live;             // 0 once a run is exhausted
+    long long comparisons;  // total key comparisons (for benchmarking)
+} LoserTree;
+
+LoserTree *createLoserTree(int k, const int *keys, const char *live);
+void freeLoserTree(LoserTree *lt);
+int loserTreeWinner(LoserTree *lt);
+int loserTreeWinnerKey(LoserTree *lt);
+void loserTreeReplace(LoserTree *lt, int key);
+void loserTreeExhaust(LoserTree *lt);
+
+long long mergeSortedArrays(const int **arrays, const int *lengths, int k, int *out);
+struct Node *mergeSortedLists(struct Node **lists, int k);
+
+#endif
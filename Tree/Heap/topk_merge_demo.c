@@ -0,0 +1,180 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "topk_merge.h"
+
+/*
+ * Test driver / benchmark for heap.c and topk_merge.c
+ *
+ * Build: gcc -O2 heap.c topk_merge.c topk_merge_demo.c -o topk -lm && ./topk
+ */
+
+static double nowSeconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int compareInts(const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static struct Node *createListNode(int value)
+{
+    struct Node *node = (struct Node *)malloc(sizeof(struct Node));
+    if (node == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        exit(1);
+    }
+    node->data = value;
+    node->inSlab = 0;
+    node->Next = NULL;
+    return node;
+}
+
+int main(void)
+{
+    // ---- Top-K of a stream ----
+    printf("Top-5 of stream: ");
+    int stream[] = {42, 7, 99, 13, 56, 88, 1, 73, 64, 99, 20};
+    int streamLength = sizeof(stream) / sizeof(stream[0]);
+
+    TopK *topk = createTopK(5);
+    for (int i = 0; i < streamLength; i++)
+        topKPush(topk, stream[i], i);
+
+    HeapItem best[5];
+    int found = topKDrain(topk, best);
+    for (int i = 0; i < found; i++)
+        printf("%lld ", best[i].key);
+    printf("\n");              // Expected: 99 99 88 73 64
+    freeTopK(topk);
+
+    // ---- Merge three sorted linked lists ----
+    int values[3][4] = {{1, 4, 7, 10}, {2, 5, 8, 11}, {3, 6, 9, 12}};
+    struct Node *lists[3];
+    for (int r = 0; r < 3; r++)
+    {
+        lists[r] = NULL;
+        for (int i = 3; i >= 0; i--)
+        {
+            struct Node *node = createListNode(values[r][i]);
+            node->Next = lists[r];
+            lists[r] = node;
+        }
+    }
+
+    struct Node *merged = mergeSortedLists(lists, 3);
+    printf("Merged lists: ");
+    for (struct Node *curr = merged; curr != NULL; curr = curr->Next)
+        printf("%d -> ", curr->data);
+    printf("NULL\n");
+    while (merged != NULL)
+    {
+        struct Node *next = merged->Next;
+        free(merged);
+        merged = next;
+    }
+
+    // ---- Benchmark: 1000 runs x 1000 elements ----
+    const int runs = 1000;
+    const int runLength = 1000;
+    long long total = (long long)runs * runLength;
+
+    int **arrays = (int **)malloc(runs * sizeof(int *));
+    int *lengths = (int *)malloc(runs * sizeof(int));
+    int *out = (int *)malloc(total * sizeof(int));
+    int *reference = (int *)malloc(total * sizeof(int));
+
+    srand(12345);
+    long long filled = 0;
+    for (int r = 0; r < runs; r++)
+    {
+        arrays[r] = (int *)malloc(runLength * sizeof(int));
+        lengths[r] = runLength;
+        for (int i = 0; i < runLength; i++)
+            arrays[r][i] = rand();
+        qsort(arrays[r], runLength, sizeof(int), compareInts);
+        for (int i = 0; i < runLength; i++)
+            reference[filled++] = arrays[r][i];
+    }
+    qsort(reference, total, sizeof(int), compareInts);
+
+    // Loser tree, with comparison counting via a local tree
+    double start = nowSeconds();
+    long long written = mergeSortedArrays((const int **)arrays, lengths, runs, out);
+    double loserTime = nowSeconds() - start;
+
+    int ok = (written == total);
+    for (long long i = 0; ok && i < total; i++)
+        ok = (out[i] == reference[i]);
+
+    int *keys = (int *)malloc(runs * sizeof(int));
+    char *live = (char *)malloc(runs);
+    int *pos = (int *)calloc(runs, sizeof(int));
+    for (int r = 0; r < runs; r++)
+    {
+        keys[r] = arrays[r][0];
+        live[r] = 1;
+    }
+    LoserTree *lt = createLoserTree(runs, keys, live);
+    lt->comparisons = 0;
+    int run;
+    while ((run = loserTreeWinner(lt)) != -1)
+    {
+        if (++pos[run] < lengths[run])
+            loserTreeReplace(lt, arrays[run][pos[run]]);
+        else
+            loserTreeExhaust(lt);
+    }
+    double perElement = (double)lt->comparisons / total;
+    freeLoserTree(lt);
+
+    // Binary heap merge for comparison
+    start = nowSeconds();
+    Heap *heap = createHeap(runs);
+    for (int r = 0; r < runs; r++)
+    {
+        pos[r] = 0;
+        heap->array[r].key = arrays[r][0];
+        heap->array[r].value = r;
+    }
+    heap->size = runs;
+    heapBuild(heap);
+    long long n = 0;
+    while (!heapIsEmpty(heap))
+    {
+        HeapItem top = heapTop(heap);
+        out[n++] = (int)top.key;
+        run = top.value;
+        if (++pos[run] < lengths[run])
+            heapReplaceTop(heap, arrays[run][pos[run]], run);
+        else
+            heapPop(heap, &top);
+    }
+    double heapTime = nowSeconds() - start;
+    freeHeap(heap);
+
+    printf("\nk-way merge of %d runs (%lld elements): %s\n", runs, total, ok ? "OK" : "MISMATCH");
+    printf("  loser tree : %.3f s, %.2f comparisons/element (log2 K = %.2f)\n",
+           loserTime, perElement, log2(runs));
+    printf("  binary heap: %.3f s\n", heapTime);
+
+    for (int r = 0; r < runs; r++)
+        free(arrays[r]);
+    free(arrays);
+    free(lengths);
+    free(out);
+    free(reference);
+    free(keys);
+    free(live);
+    free(pos);
+
+    return ok ? 0 : 1;
+}